@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  bench_accumulate.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Summing a large array of 64-bit fractions: a `+=` loop, a sequential FractionAccumulator
+// and parallelSum on the shared pool (whose result is checked against the sequential one).
+
+#include "bench_common.h"
+#include "fraction_accumulator.h"
+#include <cstdio>
+#include <stdexcept>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+
+namespace {
+    /// @brief Index of the first `+=` that overflows, or `values.size()` if none does.
+    std::size_t plusEqualsReach(const std::vector<Fraction64>& values) {
+        Fraction64 sum;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            try {
+                sum += values[i];
+            } catch (const std::overflow_error&) {
+                return i;
+            }
+        }
+        return values.size();
+    }
+
+    void run(const Distribution& dist) {
+        std::vector<Fraction64> values;
+        values.reserve(dist.pairs.size());
+        for (const auto& [n, d] : dist.pairs) values.emplace_back(n, d);
+        const std::size_t n = values.size();
+        std::printf("%s (%zu values, %zu threads)\n", dist.name.c_str(), n, FracLib::ThreadPool::shared().size());
+
+        std::size_t reach = plusEqualsReach(values);
+        double loop = measureNsPerOp(reach, [&] {
+            Fraction64 sum;
+            for (std::size_t i = 0; i < reach; ++i) sum += values[i];
+            doNotOptimize(sum);
+        });
+
+        FracLib::FractionAccumulator<std::int64_t> sequential;
+        for (const Fraction64& value : values) sequential += value;
+        FracLib::BigFraction exact = sequential.exactValue();
+        double accumulate = measureNsPerOp(n, [&] {
+            FracLib::FractionAccumulator<std::int64_t> sum;
+            for (const Fraction64& value : values) sum += value;
+            doNotOptimize(sum);
+        });
+
+        double parallel = measureNsPerOp(n, [&] {
+            doNotOptimize(FracLib::detail::treeReduce<Fraction64>(values.begin(), n, false, FracLib::ThreadPool::shared()));
+        });
+        FracLib::BigFraction tree = FracLib::detail::treeReduce<Fraction64>(values.begin(), n, false, FracLib::ThreadPool::shared()).exactValue();
+        bool identical = tree.numerator == exact.numerator && tree.denominator == exact.denominator;
+
+        if (reach == n) {
+            std::printf("  %-22s %8.1f ns/value  (no overflow)\n", "+= loop", loop);
+        } else {
+            std::printf("  %-22s %8.1f ns/value  (overflowed after %zu of %zu values)\n", "+= loop", loop, reach, n);
+        }
+        std::printf("  %-22s %8.1f ns/value  (%s, denominator %zu bits)\n", "FractionAccumulator", accumulate,
+            sequential.promoted() ? "promoted to BigInt" : "in 128 bits", exact.denominator.bitWidth());
+        std::printf("  %-22s %8.1f ns/value  (%s the sequential result)\n", "parallelSum", parallel, identical ? "identical to" : "DIFFERS from");
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 20;
+    run(smallDenominatorDistribution(count));
+    run(powerOfTenDistribution(count));
+    // Unrelated 31-bit denominators: the exact sum's denominator grows by ~31 bits per value
+    run(randomDistribution(count >> 8));
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  bench_array.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Element-wise arithmetic over std::vector<Fraction32> (one operator call per element)
+// against the FractionArray batch kernels at each SIMD level.
+
+#include "bench_common.h"
+#include "fraction_array.h"
+#include <cstdio>
+#include <stdexcept>
+
+using namespace FracLibBench;
+using FracLib::Fraction32;
+using FracLib::FractionArray;
+using FracLib::SimdLevel;
+
+namespace {
+    const char* levelName(SimdLevel level) {
+        switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE4: return "sse4";
+        default: return "scalar";
+        }
+    }
+
+    template <typename Op>
+    double timeOperators(const std::vector<Fraction32>& a, const std::vector<Fraction32>& b, std::vector<Fraction32>& out, Op op) {
+        return measureNsPerOp(a.size(), [&] {
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                try {
+                    out[i] = op(a[i], b[i]);
+                } catch (const std::overflow_error&) {
+                    out[i] = Fraction32();
+                }
+            }
+            doNotOptimize(out.data());
+        });
+    }
+
+    void run(const Distribution& dist) {
+        // Consecutive pairs form the two operands
+        std::vector<Fraction32> va, vb, vout(dist.pairs.size() / 2);
+        FractionArray a, b, result;
+        FracLib::OverflowMask overflow;
+        std::vector<std::int8_t> order;
+        for (std::size_t i = 0; i + 1 < dist.pairs.size(); i += 2) {
+            Fraction32 x(static_cast<std::int32_t>(dist.pairs[i].first), static_cast<std::int32_t>(dist.pairs[i].second));
+            Fraction32 y(static_cast<std::int32_t>(dist.pairs[i + 1].first), static_cast<std::int32_t>(dist.pairs[i + 1].second));
+            va.push_back(x);
+            vb.push_back(y);
+            a.push_back(x);
+            b.push_back(y);
+        }
+        const std::size_t n = va.size();
+        std::printf("%s (%zu elements, %zu overflow on add)\n", dist.name.c_str(), n, FracLib::batchAdd(a, b, result, overflow));
+
+        double add = timeOperators(va, vb, vout, [](const Fraction32& x, const Fraction32& y) { return x + y; });
+        double mul = timeOperators(va, vb, vout, [](const Fraction32& x, const Fraction32& y) { return x * y; });
+        double div = timeOperators(va, vb, vout, [](const Fraction32& x, const Fraction32& y) { return x / y; });
+        double cmp = measureNsPerOp(n, [&] {
+            for (std::size_t i = 0; i < n; ++i) order.push_back(static_cast<std::int8_t>((va[i] > vb[i]) - (va[i] < vb[i])));
+            doNotOptimize(order.data());
+            order.clear();
+        });
+        std::printf("  %-8s add %6.2f ns  mul %6.2f ns  div %6.2f ns  compare %6.2f ns\n", "operator", add, mul, div, cmp);
+
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE4, SimdLevel::AVX2}) {
+            if (static_cast<int>(level) > static_cast<int>(FracLib::supportedSimdLevel())) continue;
+            FracLib::setSimdLevel(level);
+            double badd = measureNsPerOp(n, [&] { doNotOptimize(FracLib::batchAdd(a, b, result, overflow)); });
+            double bmul = measureNsPerOp(n, [&] { doNotOptimize(FracLib::batchMultiply(a, b, result, overflow)); });
+            double bdiv = measureNsPerOp(n, [&] { doNotOptimize(FracLib::batchDivide(a, b, result, overflow)); });
+            double bcmp = measureNsPerOp(n, [&] { FracLib::batchCompare(a, b, order); doNotOptimize(order.data()); });
+            std::printf("  %-8s add %6.2f ns  mul %6.2f ns  div %6.2f ns  compare %6.2f ns  (add %.1fx)\n",
+                levelName(level), badd, bmul, bdiv, bcmp, add / badd);
+        }
+        FracLib::setSimdLevel(FracLib::supportedSimdLevel());
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 15; // both operands and the result stay in L2
+    run(smallDenominatorDistribution(count));
+    run(powerOfTenDistribution(count));
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  bench_cache.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// A feed that repeats a vocabulary of fraction strings: parsing every field with the string
+// constructor, and through a FractionParseCache, on one thread and on the shared pool, as
+// the vocabulary grows past the front cache and then past the shared table.
+
+#include "bench_common.h"
+#include "fraction_cache.h"
+#include "thread_pool.h"
+#include <cstdio>
+#include <string>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+
+namespace {
+    std::string mixedText(std::int64_t n, std::int64_t d) {
+        std::int64_t whole = n / d;
+        if (whole == 0 || n % d == 0) return std::to_string(n) + "/" + std::to_string(d);
+        return std::to_string(whole) + " " + std::to_string(n % d < 0 ? -(n % d) : n % d) + "/" + std::to_string(d);
+    }
+
+    void run(std::size_t vocabularySize, std::size_t capacity) {
+        const std::size_t count = 1 << 16;
+        Distribution words = smallDenominatorDistribution(vocabularySize);
+        std::vector<std::string> vocabulary;
+        for (auto [n, d] : words.pairs) vocabulary.push_back(mixedText(n, d));
+        std::mt19937_64 rng(25);
+        std::vector<std::string_view> feed(count);
+        for (std::string_view& field : feed) field = vocabulary[rng() % vocabulary.size()];
+
+        FracLib::FractionParseCache<Fraction64> cache(capacity);
+        FracLib::ThreadPool& pool = FracLib::ThreadPool::shared();
+        const std::size_t tasks = 64;
+        std::printf("%zu distinct strings, capacity %zu\n", vocabularySize, cache.capacity());
+        for (bool simplify : {false, true}) {
+            double constructor = measureNsPerOp(count, [&] {
+                for (std::string_view field : feed) doNotOptimize(Fraction64(field, simplify));
+            });
+            cache.resetStats();
+            double cached = measureNsPerOp(count, [&] {
+                for (std::string_view field : feed) doNotOptimize(cache.parse(field, simplify));
+            });
+            FracLib::ParseCacheStats stats = cache.stats();
+            double constructorPool = measureNsPerOp(count, [&] {
+                pool.parallelFor(tasks, [&](std::size_t task) {
+                    for (std::size_t i = task; i < count; i += tasks) doNotOptimize(Fraction64(feed[i], simplify));
+                });
+            });
+            double cachedPool = measureNsPerOp(count, [&] {
+                pool.parallelFor(tasks, [&](std::size_t task) {
+                    for (std::size_t i = task; i < count; i += tasks) doNotOptimize(cache.parse(feed[i], simplify));
+                });
+            });
+            const double lookups = static_cast<double>(stats.lookups());
+            std::printf("  %s (front %.1f%%, shared %.1f%%, parsed %.1f%%)\n", simplify ? "simplified" : "as written",
+                100.0 * static_cast<double>(stats.frontHits) / lookups, 100.0 * static_cast<double>(stats.sharedHits) / lookups,
+                100.0 * static_cast<double>(stats.misses + stats.uncached) / lookups);
+            std::printf("    %-22s %8.2f ns/op\n", "string constructor", constructor);
+            std::printf("    %-22s %8.2f ns/op\n", "FractionParseCache", cached);
+            std::printf("    %-22s %8.2f ns/op (%zu threads)\n", "constructor, pool", constructorPool, pool.size());
+            std::printf("    %-22s %8.2f ns/op (%zu threads)\n", "cache, pool", cachedPool, pool.size());
+        }
+    }
+}
+
+int main() {
+    run(64, 4096);
+    run(1024, 4096);
+    run(16384, 4096);
+    return 0;
+}
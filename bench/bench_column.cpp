@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  bench_column.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Storing a column of fractions as text (operator<<, read back with loadFractions) against
+// the binary column format (writeFractionColumn, read back with FractionColumnReader):
+// file size, bulk read throughput and random access.
+
+#include "bench_common.h"
+#include "fraction_column.h"
+#include "fraction_loader.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+
+namespace {
+    std::size_t fileSize(const std::string& path) {
+        std::ifstream probe(path, std::ios::binary | std::ios::ate);
+        return static_cast<std::size_t>(probe.tellg());
+    }
+
+    void run(const Distribution& dist) {
+        const std::string textPath = "bench_column_input.txt";
+        const std::string columnPath = "bench_column_input.frc";
+        std::vector<Fraction64> values;
+        values.reserve(dist.pairs.size());
+        for (auto [n, d] : dist.pairs) values.emplace_back(n, d);
+        const double count = static_cast<double>(values.size());
+
+        double textWrite = measureNsPerOp(values.size(), [&] {
+            std::ofstream out(textPath, std::ios::binary);
+            for (const Fraction64& value : values) out << value << '\n';
+        }, 1.0);
+        double columnWrite = measureNsPerOp(values.size(), [&] {
+            FracLib::writeFractionColumn(columnPath, values.data(), values.size());
+        }, 1.0);
+        std::size_t textBytes = fileSize(textPath);
+        std::size_t columnBytes = fileSize(columnPath);
+        std::printf("%s (%zu values)\n", dist.name.c_str(), values.size());
+        std::printf("  %-26s %8.2f bytes/value  write %6.1f ns/value\n", "text", static_cast<double>(textBytes) / count, textWrite);
+        std::printf("  %-26s %8.2f bytes/value  write %6.1f ns/value\n", "column", static_cast<double>(columnBytes) / count, columnWrite);
+
+        FracLib::ThreadPool single(1);
+        for (FracLib::ThreadPool* pool : {&single, &FracLib::ThreadPool::shared()}) {
+            FracLib::LoadOptions options;
+            options.pool = pool;
+            double ns = measureNsPerOp(values.size(), [&] {
+                auto loaded = FracLib::loadFractions<Fraction64>(textPath, options);
+                if (loaded.values.size() != values.size()) throw std::runtime_error("loader mismatch");
+                doNotOptimize(loaded.values.data());
+            }, 1.0);
+            char name[40];
+            std::snprintf(name, sizeof(name), "loadFractions (%zu thr)", pool->size());
+            std::printf("  %-26s %8.1f M values/s\n", name, 1e3 / ns);
+        }
+        for (FracLib::ThreadPool* pool : {&single, &FracLib::ThreadPool::shared()}) {
+            double ns = measureNsPerOp(values.size(), [&] {
+                FracLib::FractionColumnReader<Fraction64> column(columnPath);
+                auto loaded = column.readAll(pool);
+                if (loaded.size() != values.size() || loaded.back().numerator != values.back().numerator) throw std::runtime_error("column mismatch");
+                doNotOptimize(loaded.data());
+            }, 1.0);
+            char name[40];
+            std::snprintf(name, sizeof(name), "column readAll (%zu thr)", pool->size());
+            std::printf("  %-26s %8.1f M values/s\n", name, 1e3 / ns);
+        }
+
+        FracLib::FractionColumnReader<Fraction64> column(columnPath);
+        std::mt19937_64 rng(20);
+        std::vector<std::size_t> positions(1 << 14);
+        for (std::size_t& p : positions) p = rng() % values.size();
+        double atNs = measureNsPerOp(positions.size(), [&] {
+            for (std::size_t p : positions) doNotOptimize(column.at(p));
+        }, 1.0);
+        std::printf("  %-26s %8.1f us/value (blocks of %zu)\n", "column at()", atNs / 1e3, column.blockSize());
+
+        std::remove(textPath.c_str());
+        std::remove(columnPath.c_str());
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 21;
+    for (const Distribution& dist : {randomDistribution(count), smallDenominatorDistribution(count), powerOfTenDistribution(count)}) {
+        run(dist);
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  bench_common.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+// Shared helpers for the FracLib benchmarks: timing, optimizer barriers and seeded
+// input distributions. Not part of the installed library.
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace FracLibBench {
+    /// @brief Keeps the optimizer from discarding a computed value.
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+
+    /// @brief Runs `body` (which processes `opsPerRun` items) repeatedly for at least
+    /// `minSeconds` and returns the best observed nanoseconds per item.
+    template <typename Body>
+    double measureNsPerOp(std::size_t opsPerRun, Body&& body, double minSeconds = 0.25) {
+        using Clock = std::chrono::steady_clock;
+        double best = 1e300;
+        auto begin = Clock::now();
+        do {
+            auto start = Clock::now();
+            body();
+            auto stop = Clock::now();
+            double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(opsPerRun);
+            if (ns < best) best = ns;
+        } while (std::chrono::duration<double>(Clock::now() - begin).count() < minSeconds);
+        return best;
+    }
+
+    /// @brief A named set of (numerator, denominator) pairs drawn from a seeded generator.
+    struct Distribution {
+        std::string name;
+        std::vector<std::pair<std::int64_t, std::int64_t>> pairs;
+    };
+
+    /// @brief Uniform numerators and denominators in [1, 2^bits - 1], named "random<bits>".
+    inline Distribution randomDistribution(std::size_t count, int bits = 31, std::uint64_t seed = 1) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<std::int64_t> value(1, (std::int64_t(1) << bits) - 1);
+        Distribution dist{"random" + std::to_string(bits), {}};
+        dist.pairs.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) dist.pairs.emplace_back(value(rng), value(rng));
+        return dist;
+    }
+
+    /// @brief Prices and measurements: binary denominators (2..64) and small integers, with
+    /// unreduced numerators as produced by unsimplified arithmetic.
+    inline Distribution smallDenominatorDistribution(std::size_t count, std::uint64_t seed = 2) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<int> shift(1, 6);
+        std::uniform_int_distribution<std::int64_t> whole(0, 500);
+        std::uniform_int_distribution<std::int64_t> scale(1, 12);
+        Distribution dist{"smallDenominators", {}};
+        dist.pairs.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::int64_t den = std::int64_t(1) << shift(rng);
+            std::uniform_int_distribution<std::int64_t> part(1, den - 1);
+            std::int64_t k = scale(rng);
+            dist.pairs.emplace_back((whole(rng) * den + part(rng)) * k, den * k);
+        }
+        return dist;
+    }
+
+    /// @brief Decimal inputs: numerators over powers of ten (10..10^6), as produced by
+    /// converting decimal strings.
+    inline Distribution powerOfTenDistribution(std::size_t count, std::uint64_t seed = 3) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<int> places(1, 6);
+        Distribution dist{"powersOfTen", {}};
+        dist.pairs.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::int64_t den = 1;
+            for (int p = places(rng); p > 0; --p) den *= 10;
+            std::uniform_int_distribution<std::int64_t> num(1, den * 100);
+            dist.pairs.emplace_back(num(rng), den);
+        }
+        return dist;
+    }
+}
@@ -0,0 +1,173 @@
+/**************************************************************************/
+/*  bench_compare.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+
+// Comparing fractions: cross-multiplication in plain int (FracLib 1.1), cross-multiplication
+// in the wider type (the previous operators), and the tiered compare() behind the operators.
+// For the widest type and BigFraction, compare() with its floating-point filter against
+// exact arithmetic alone.
+
+#include "bench_common.h"
+#include "bigint.h"
+#include "fraction.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace FracLibBench;
+using FracLib::Fraction32;
+using FracLib::Fraction64;
+
+namespace {
+    /// @brief FracLib 1.1's operator<: wraps once a cross product exceeds int.
+    bool intLess(const Fraction32& a, const Fraction32& b) {
+        return static_cast<int>(static_cast<unsigned>(a.numerator) * static_cast<unsigned>(b.denominator)) <
+            static_cast<int>(static_cast<unsigned>(b.numerator) * static_cast<unsigned>(a.denominator));
+    }
+
+    /// @brief The previous operator<: exact in 64 bits, but wrong for negative denominators.
+    bool wideLess(const Fraction32& a, const Fraction32& b) {
+        return std::int64_t(a.numerator) * b.denominator < std::int64_t(b.numerator) * a.denominator;
+    }
+
+    template <typename Less>
+    double measureLess(const std::vector<Fraction32>& values, Less less) {
+        const std::size_t n = values.size() - 1;
+        return measureNsPerOp(n, [&] {
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < n; ++i) count += less(values[i], values[i + 1]);
+            doNotOptimize(count);
+        });
+    }
+
+    void run(const Distribution& dist) {
+        std::vector<Fraction32> values;
+        for (const auto& [n, d] : dist.pairs) {
+            // Keep the components in int; differences give both signs
+            values.emplace_back(static_cast<std::int32_t>((n - d) / 2), static_cast<std::int32_t>(d), false);
+        }
+        std::size_t intWrong = 0;
+        for (std::size_t i = 0; i + 1 < values.size(); ++i) intWrong += intLess(values[i], values[i + 1]) != (values[i] < values[i + 1]);
+        std::printf("%s (%zu values)\n", dist.name.c_str(), values.size());
+
+        double plain = measureLess(values, intLess);
+        double wide = measureLess(values, wideLess);
+        double tiered = measureLess(values, [](const Fraction32& a, const Fraction32& b) { return a < b; });
+        std::printf("  %-24s %6.2f ns  (%zu wrong)\n", "int cross-multiply", plain, intWrong);
+        std::printf("  %-24s %6.2f ns\n", "int64 cross-multiply", wide);
+        std::printf("  %-24s %6.2f ns\n", "compare()", tiered);
+
+        double sorted = measureNsPerOp(values.size(), [&] {
+            std::vector<Fraction32> copy = values;
+            std::sort(copy.begin(), copy.end());
+            doNotOptimize(copy.data());
+        });
+        std::printf("  %-24s %6.2f ns per element\n", "std::sort", sorted);
+    }
+
+    /// @brief Exact comparison without the floating-point filter: the 128-bit cross products
+    /// when they fit, continued fractions otherwise (positive operands).
+    template <typename U>
+    int exactOrder(U an, U ad, U bn, U bd) {
+        U left = 0, right = 0;
+        if (!FracLib::detail::mulOverflow(an, bd, left) && !FracLib::detail::mulOverflow(bn, ad, right)) {
+            return (left > right) - (left < right);
+        }
+        return FracLib::detail::compareMagnitudes(an, ad, bn, bd);
+    }
+
+    template <typename Fraction, typename Exact>
+    void measureFiltered(const char* name, const std::vector<Fraction>& values, Exact exact) {
+        const std::size_t n = values.size() - 1;
+        FracLib::resetCompareStats();
+        double filtered = measureNsPerOp(n, [&] {
+            std::size_t less = 0;
+            for (std::size_t i = 0; i < n; ++i) less += values[i] < values[i + 1];
+            doNotOptimize(less);
+        });
+        FracLib::CompareStats stats = FracLib::compareStats();
+        double unfiltered = measureNsPerOp(n, [&] {
+            std::size_t less = 0;
+            for (std::size_t i = 0; i < n; ++i) less += exact(values[i], values[i + 1]) < 0;
+            doNotOptimize(less);
+        });
+        std::printf("%s (%zu values)\n  %-24s %7.2f ns\n  %-24s %7.2f ns  (exact fallback %.2f%%)\n", name, values.size(),
+            "exact only", unfiltered, "compare()", filtered, 100.0 * stats.fallbackRate());
+    }
+
+    /// @brief Full-width operands: Fraction64 (exact in 128 bits), then the widest type and
+    /// BigFraction, where compare() filters with doubles before any exact arithmetic.
+    void runWidest(std::size_t count) {
+        std::mt19937_64 rng(4);
+        std::vector<Fraction64> values;
+        for (std::size_t i = 0; i < count; ++i) {
+            auto n = static_cast<std::int64_t>(rng() >> 1);
+            auto d = static_cast<std::int64_t>(rng() >> 1) | 1;
+            values.emplace_back(n, d, false);
+        }
+        double tiered = measureNsPerOp(count - 1, [&] {
+            std::size_t less = 0;
+            for (std::size_t i = 0; i + 1 < count; ++i) less += values[i] < values[i + 1];
+            doNotOptimize(less);
+        });
+        std::printf("fullWidth64 (%zu values)\n  %-24s %7.2f ns\n", count, "compare()", tiered);
+#ifdef FRACLIB_HAS_INT128
+        using FracLib::Fraction128;
+        using FracLib::uint128_t;
+        auto exact128 = [](const Fraction128& a, const Fraction128& b) {
+            return exactOrder<uint128_t>(a.numerator, a.denominator, b.numerator, b.denominator);
+        };
+        std::vector<Fraction128> wide, narrow;
+        for (const Fraction64& f : values) {
+            wide.emplace_back(FracLib::int128_t(f.numerator) << 62 | (rng() >> 2), FracLib::int128_t(f.denominator) << 62 | (rng() >> 2), false);
+            narrow.emplace_back(f.numerator >> 4, f.denominator >> 4 | 1, false);
+        }
+        measureFiltered("fullWidth128", wide, exact128);
+        measureFiltered("halfWidth128", narrow, exact128);
+#endif
+        std::vector<FracLib::BigFraction> big;
+        for (std::size_t i = 0; i < count; ++i) {
+            FracLib::BigInt n = FracLib::BigInt(static_cast<std::int64_t>(rng() >> 1)) * FracLib::BigInt(static_cast<std::int64_t>(rng() >> 1));
+            FracLib::BigInt d = FracLib::BigInt(static_cast<std::int64_t>(rng() >> 1)) * FracLib::BigInt(static_cast<std::int64_t>(rng() >> 1)) + FracLib::BigInt(1);
+            big.emplace_back(n * n, d * d, false);
+        }
+        measureFiltered("big256", big, [](const FracLib::BigFraction& a, const FracLib::BigFraction& b) {
+            FracLib::BigInt left = a.numerator * b.denominator;
+            FracLib::BigInt right = b.numerator * a.denominator;
+            return (left > right) - (left < right);
+        });
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 16;
+    for (const Distribution& dist : {randomDistribution(count), smallDenominatorDistribution(count), powerOfTenDistribution(count)}) run(dist);
+    runWidest(count);
+    return 0;
+}
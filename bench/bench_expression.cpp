@@ -0,0 +1,130 @@
+/**************************************************************************/
+/*  bench_expression.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+
+// Chained formulas evaluated with the ordinary operators (one temporary, range check and
+// possible reduction per operation) and as fused expressions (one fold in the wide type and
+// one narrowing per formula). Reports time per formula and checks both give the same value.
+
+#include "bench_common.h"
+#include "fraction_expression.h"
+#include <cstdio>
+#include <stdexcept>
+
+using namespace FracLibBench;
+
+namespace {
+    /// @brief Operands for `count` formulas of four fractions each.
+    template <typename F>
+    std::vector<F> operands(const Distribution& dist) {
+        std::vector<F> values;
+        values.reserve(dist.pairs.size());
+        for (const auto& [n, d] : dist.pairs) values.emplace_back(static_cast<typename F::value_type>(n), static_cast<typename F::value_type>(d), true);
+        return values;
+    }
+
+    struct MultiplyAdd {
+        static constexpr const char* name = "a + b * c - d";
+        template <typename T>
+        static auto apply(const T& a, const T& b, const T& c, const T& d) { return a + b * c - d; }
+    };
+    struct Ratio {
+        static constexpr const char* name = "(a * b + c * d) / (a + c)";
+        template <typename T>
+        static auto apply(const T& a, const T& b, const T& c, const T& d) { return (a * b + c * d) / (a + c); }
+    };
+    struct Horner {
+        static constexpr const char* name = "((a * d + b) * d + c) * d";
+        template <typename T>
+        static auto apply(const T& a, const T& b, const T& c, const T& d) { return ((a * d + b) * d + c) * d; }
+    };
+
+    /// @brief Evaluates every formula; one that overflows is counted and left as 0/0.
+    template <typename F, typename Formula, bool Fused>
+    std::size_t runFormulas(const std::vector<F>& values, std::vector<F>& results) {
+        std::size_t overflowed = 0;
+        for (std::size_t i = 0; i + 3 < values.size(); i += 4) {
+            F r;
+            r.denominator = 0;
+            try {
+                if constexpr (Fused) {
+                    auto [a, b, c, d] = FracLib::fuse(values[i], values[i + 1], values[i + 2], values[i + 3]);
+                    r = Formula::apply(a, b, c, d);
+                } else {
+                    r = F(Formula::apply(values[i], values[i + 1], values[i + 2], values[i + 3]));
+                }
+            } catch (const std::overflow_error&) {
+                ++overflowed;
+            }
+            results[i / 4] = r;
+        }
+        return overflowed;
+    }
+
+    template <typename F, typename Formula>
+    void measure(const char* typeName, const std::vector<F>& values) {
+        std::size_t count = values.size() / 4;
+        std::vector<F> stepwise(count), fused(count);
+        std::size_t stepOverflowed = runFormulas<F, Formula, false>(values, stepwise);
+        std::size_t fusedOverflowed = runFormulas<F, Formula, true>(values, fused);
+        std::size_t differ = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            // Formulas only one side evaluates count as differing
+            if (stepwise[i].denominator != 0 || fused[i].denominator != 0) {
+                differ += stepwise[i].denominator == 0 || fused[i].denominator == 0 || stepwise[i] != fused[i];
+            }
+        }
+        double stepNs = measureNsPerOp(count, [&] { doNotOptimize(runFormulas<F, Formula, false>(values, stepwise)); });
+        double fusedNs = measureNsPerOp(count, [&] { doNotOptimize(runFormulas<F, Formula, true>(values, fused)); });
+        std::printf("  %-11s %-27s operators %7.1f ns  fused %7.1f ns  x%-5.2f overflowed %zu/%zu  differ %zu\n",
+            typeName, Formula::name, stepNs, fusedNs, stepNs / fusedNs, stepOverflowed, fusedOverflowed, differ);
+    }
+
+    template <typename F>
+    void runType(const char* typeName, const Distribution& dist) {
+        std::vector<F> values = operands<F>(dist);
+        measure<F, MultiplyAdd>(typeName, values);
+        measure<F, Ratio>(typeName, values);
+        measure<F, Horner>(typeName, values);
+    }
+
+    void run(const Distribution& dist) {
+        std::printf("%s (%zu formulas, ns per formula)\n", dist.name.c_str(), dist.pairs.size() / 4);
+        runType<FracLib::Fraction32>("Fraction32", dist);
+        runType<FracLib::Fraction64>("Fraction64", dist);
+        runType<FracLib::NormalizedFraction<std::int64_t>>("Normalized", dist);
+    }
+}
+
+int main() {
+    run(smallDenominatorDistribution(1 << 16));
+    run(powerOfTenDistribution(1 << 16));
+    return 0;
+}
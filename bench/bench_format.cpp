@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*  bench_format.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+// Formatting fractions as text: the previous toString (three std::string temporaries),
+// operator<< into an ostringstream, and to_chars for one value and for a whole batch.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+using FracLib::FractionFormat;
+
+namespace {
+    /// @brief The toString implementation before to_chars, kept as the baseline.
+    std::string concatToString(const Fraction64& f) {
+        return std::to_string(f.numerator) + "/" + std::to_string(f.denominator);
+    }
+
+    void run(const Distribution& dist) {
+        std::vector<Fraction64> values;
+        for (const auto& [n, d] : dist.pairs) values.emplace_back(n - d, d);
+        const std::size_t n = values.size();
+        std::vector<char> buffer(n * (FracLib::maxFormattedChars<std::int64_t> + 1));
+        std::printf("%s (%zu values)\n", dist.name.c_str(), n);
+
+        double concat = measureNsPerOp(n, [&] {
+            for (const Fraction64& f : values) doNotOptimize(concatToString(f).size());
+        });
+        double toString = measureNsPerOp(n, [&] {
+            for (const Fraction64& f : values) doNotOptimize(Fraction64::toString(f).size());
+        });
+        double stream = measureNsPerOp(n, [&] {
+            std::ostringstream os;
+            for (const Fraction64& f : values) os << f << '\n';
+            doNotOptimize(os.tellp());
+        });
+        std::printf("  %-22s %6.2f ns\n  %-22s %6.2f ns\n  %-22s %6.2f ns\n",
+            "std::to_string concat", concat, "toString", toString, "operator<<", stream);
+
+        for (FractionFormat format : {FractionFormat::Improper, FractionFormat::Mixed, FractionFormat::Reduced}) {
+            const char* name = format == FractionFormat::Improper ? "improper" : format == FractionFormat::Mixed ? "mixed" : "reduced";
+            double single = measureNsPerOp(n, [&] {
+                char* p = buffer.data();
+                char* last = p + buffer.size();
+                for (const Fraction64& f : values) {
+                    p = FracLib::to_chars(p, last, f, format).ptr;
+                    *p++ = '\n';
+                }
+                doNotOptimize(p);
+            });
+            double batch = measureNsPerOp(n, [&] {
+                doNotOptimize(FracLib::to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), n, format).ptr);
+            });
+            std::printf("  to_chars %-13s %6.2f ns  batch %6.2f ns  (%.1fx concat)\n", name, single, batch, concat / batch);
+        }
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 16;
+    for (const Distribution& dist : {randomDistribution(count), smallDenominatorDistribution(count)}) run(dist);
+    return 0;
+}
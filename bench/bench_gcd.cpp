@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  bench_gcd.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Compares the binary GCD engine behind Fraction::simplify() with the modulo-based
+// Euclid loop it replaced, on random and real-world inputs.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include <cstdio>
+#include <cstdlib>
+
+using namespace FracLibBench;
+
+namespace {
+    // The loop simplify() used before the GCD engine (operands must be non-zero).
+    int legacyGcd(int a, int b) {
+        a = std::abs(a);
+        b = std::abs(b);
+        while (true) {
+            if (a > b) {
+                a = a % b;
+                if (a == 0) return b;
+            } else {
+                b = b % a;
+                if (b == 0) return a;
+            }
+        }
+    }
+
+    void run(const Distribution& dist) {
+        std::vector<int> a, b;
+        for (const auto& p : dist.pairs) {
+            a.push_back(static_cast<int>(p.first));
+            b.push_back(static_cast<int>(p.second));
+        }
+        const std::size_t n = a.size();
+
+        double legacy = measureNsPerOp(n, [&] {
+            unsigned sum = 0;
+            for (std::size_t i = 0; i < n; ++i) sum += static_cast<unsigned>(legacyGcd(a[i], b[i]));
+            doNotOptimize(sum);
+        });
+        double engine = measureNsPerOp(n, [&] {
+            unsigned sum = 0;
+            for (std::size_t i = 0; i < n; ++i) sum += FracLib::gcd(a[i], b[i]);
+            doNotOptimize(sum);
+        });
+        double simplify = measureNsPerOp(n, [&] {
+            long long sum = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                FracLib::Fraction f(a[i], b[i]);
+                FracLib::Fraction::SimplifyFraction(f);
+                sum += f.denominator;
+            }
+            doNotOptimize(sum);
+        });
+
+        std::printf("%-18s legacy %7.2f ns  binary %7.2f ns  speedup %5.2fx  simplify() %7.2f ns\n",
+            dist.name.c_str(), legacy, engine, legacy / engine, simplify);
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 16;
+    std::printf("gcd of %zu int32 pairs (table bound %d)\n", count, FRACLIB_GCD_TABLE_BOUND);
+    run(randomDistribution(count));
+    run(smallDenominatorDistribution(count));
+    run(powerOfTenDistribution(count));
+    return 0;
+}
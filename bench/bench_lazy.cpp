@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*  bench_lazy.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Chains of arithmetic on 64-bit fractions: never reducing (the default), reducing every
+// result (Normalized) and reducing only past a threshold (Lazy). Reports time per
+// operation, reductions (GCDs) per operation, including reducing the operands, and how
+// many chains overflowed.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include <cstdio>
+#include <stdexcept>
+
+using namespace FracLibBench;
+
+namespace {
+    struct Step {
+        char op;
+        std::int64_t n;
+        std::int64_t d;
+    };
+    using Chain = std::vector<Step>;
+
+    /// @brief (i + 1) / i for i = 1..length: the running product telescopes to length + 1.
+    std::vector<Chain> telescopingChains(std::size_t count, std::size_t length) {
+        std::vector<Chain> chains(count);
+        for (std::size_t c = 0; c < count; ++c) {
+            std::int64_t start = static_cast<std::int64_t>(c % 7) + 1;
+            for (std::size_t i = 0; i < length; ++i) {
+                std::int64_t k = start + static_cast<std::int64_t>(i);
+                chains[c].push_back({'*', k + 1, k});
+            }
+        }
+        return chains;
+    }
+
+    /// @brief Small random operands (components up to 12) under all four operators.
+    std::vector<Chain> mixedChains(std::size_t count, std::size_t length, std::uint64_t seed = 16) {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<std::int64_t> value(1, 12);
+        std::uniform_int_distribution<int> op(0, 3);
+        std::vector<Chain> chains(count);
+        for (Chain& chain : chains) {
+            for (std::size_t i = 0; i < length; ++i) chain.push_back({"+-*/"[op(rng)], value(rng), value(rng)});
+        }
+        return chains;
+    }
+
+    /// @brief Sums of price * quantity, both decimals, as in an invoice total.
+    std::vector<Chain> invoiceChains(std::size_t count, std::size_t length) {
+        Distribution prices = powerOfTenDistribution(count * length);
+        std::vector<Chain> chains(count);
+        std::size_t next = 0;
+        for (Chain& chain : chains) {
+            for (std::size_t i = 0; i < length; ++i, ++next) {
+                std::int64_t quantity = static_cast<std::int64_t>(next % 9) + 1;
+                chain.push_back({'+', prices.pairs[next].first * quantity, prices.pairs[next].second});
+            }
+        }
+        return chains;
+    }
+
+    template <typename F>
+    F apply(const F& acc, const Step& step) {
+        F operand(step.n, step.d);
+        switch (step.op) {
+        case '+': return acc + operand;
+        case '-': return acc - operand;
+        case '*': return acc * operand;
+        default: return acc / operand;
+        }
+    }
+
+    /// @brief Runs every chain from 1; a chain that overflows is counted and abandoned.
+    template <typename F>
+    std::size_t runChains(const std::vector<Chain>& chains) {
+        std::size_t overflowed = 0;
+        for (const Chain& chain : chains) {
+            F acc(1);
+            try {
+                for (const Step& step : chain) acc = apply(acc, step);
+            } catch (const std::overflow_error&) {
+                ++overflowed;
+            }
+            doNotOptimize(acc);
+        }
+        return overflowed;
+    }
+
+    template <typename F>
+    void measure(const char* name, const std::vector<Chain>& chains) {
+        std::size_t ops = chains.size() * chains.front().size();
+        FracLib::resetReductionStats();
+        std::size_t overflowed = runChains<F>(chains);
+        FracLib::ReductionStats stats = FracLib::reductionStats();
+        double ns = measureNsPerOp(ops, [&] { doNotOptimize(runChains<F>(chains)); });
+        if (F::is_normalized || F::is_lazy) {
+            std::printf("  %-22s %8.1f ns/op  %6.3f reductions/op  %zu of %zu chains overflowed\n", name, ns,
+                static_cast<double>(stats.reduced) / static_cast<double>(ops), overflowed, chains.size());
+        } else {
+            // Only reduces results that overflow, and those are not counted
+            std::printf("  %-22s %8.1f ns/op  %6s reductions/op  %zu of %zu chains overflowed\n", name, ns, "-",
+                overflowed, chains.size());
+        }
+    }
+
+    void run(const char* name, const std::vector<Chain>& chains) {
+        std::printf("%s (%zu chains of %zu operations)\n", name, chains.size(), chains.front().size());
+        measure<FracLib::Fraction64>("never reduce", chains);
+        measure<FracLib::NormalizedFraction<std::int64_t>>("Normalized", chains);
+        measure<FracLib::LazyFraction<std::int64_t>>("Lazy (32 bits)", chains);
+        measure<FracLib::LazyFraction<std::int64_t, FracLib::ThrowOnOverflow, 48>>("Lazy (48 bits)", chains);
+    }
+}
+
+int main() {
+    run("telescoping product", telescopingChains(4096, 64));
+    run("mixed + - * /", mixedChains(4096, 32));
+    run("invoice total", invoiceChains(4096, 32));
+    return 0;
+}
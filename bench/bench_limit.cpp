@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  bench_limit.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+
+// Best rational approximation with a bounded denominator: a naive scan over every
+// denominator, Fraction64::limitDenominator, and the Fraction32 batch path.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include "fraction_array.h"
+#include <cmath>
+#include <cstdio>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+
+namespace {
+    /// @brief Tries every denominator up to `maxDenominator` and keeps the closest p/q.
+    Fraction64 naiveLimit(double x, std::int64_t maxDenominator) {
+        long double best = 1e300L;
+        std::int64_t bestP = 0, bestQ = 1;
+        for (std::int64_t q = 1; q <= maxDenominator; ++q) {
+            std::int64_t p = std::llround(x * static_cast<double>(q));
+            long double error = std::fabs(static_cast<long double>(x) - static_cast<long double>(p) / q);
+            if (error < best) {
+                best = error;
+                bestP = p;
+                bestQ = q;
+            }
+        }
+        return Fraction64(bestP, bestQ, true);
+    }
+
+    void run(const Distribution& dist, std::int64_t maxDenominator) {
+        std::vector<double> values;
+        values.reserve(dist.pairs.size());
+        for (const auto& [n, d] : dist.pairs) values.push_back(static_cast<double>(n) / static_cast<double>(d));
+        const std::size_t n = values.size();
+        std::printf("%s, maxDenominator %lld (%zu values)\n", dist.name.c_str(), static_cast<long long>(maxDenominator), n);
+
+        // The naive scan is O(maxDenominator) per value, so time it on a prefix
+        const std::size_t naiveCount = maxDenominator > 10000 ? 16 : 512;
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < naiveCount; ++i) {
+            if (naiveLimit(values[i], maxDenominator) != Fraction64::limitDenominator(values[i], maxDenominator)) ++mismatches;
+        }
+        double naive = measureNsPerOp(naiveCount, [&] {
+            for (std::size_t i = 0; i < naiveCount; ++i) doNotOptimize(naiveLimit(values[i], maxDenominator).numerator);
+        });
+
+        std::vector<Fraction64> out(n);
+        double scalar = measureNsPerOp(n, [&] {
+            Fraction64::limitDenominators(values.data(), n, maxDenominator, out.data());
+            doNotOptimize(out.data());
+        });
+
+        FracLib::FractionArray result;
+        FracLib::OverflowMask overflow;
+        double batch = measureNsPerOp(n, [&] {
+            doNotOptimize(FracLib::batchLimitDenominator(values.data(), n, static_cast<std::int32_t>(maxDenominator), result, overflow));
+        });
+
+        std::printf("  %-22s %12.1f ns  (%zu of %zu differ from limitDenominator)\n", "naive scan", naive, mismatches, naiveCount);
+        std::printf("  %-22s %12.1f ns  %7.2f M values/s\n", "limitDenominator", scalar, 1e3 / scalar);
+        std::printf("  %-22s %12.1f ns  %7.2f M values/s  (%.0fx naive)\n", "batchLimitDenominator", batch, 1e3 / batch, naive / batch);
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 16;
+    for (const Distribution& dist : {randomDistribution(count), smallDenominatorDistribution(count), powerOfTenDistribution(count)}) {
+        for (std::int64_t maxDenominator : {std::int64_t(1000), std::int64_t(1000000)}) run(dist, maxDenominator);
+    }
+    return 0;
+}
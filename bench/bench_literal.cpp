@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*  bench_literal.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Fraction constants written as text: a chain of operators whose right-hand sides are
+// string operands (parsed on every call), the same constants as `_frac64` literals (parsed
+// by the compiler) and, for reference, fractions built from integers.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include <cstdio>
+
+using namespace FracLibBench;
+using namespace FracLib::literals;
+using FracLib::Fraction64;
+
+int main() {
+    const std::size_t count = 1 << 16;
+    Distribution dist = smallDenominatorDistribution(count);
+    std::vector<Fraction64> values;
+    values.reserve(dist.pairs.size());
+    for (auto [n, d] : dist.pairs) values.emplace_back(n, d);
+
+    double strings = measureNsPerOp(values.size(), [&] {
+        for (const Fraction64& value : values) {
+            doNotOptimize((value + "3/4") * "2/3" - "1 1/2");
+        }
+    });
+    double literals = measureNsPerOp(values.size(), [&] {
+        for (const Fraction64& value : values) {
+            doNotOptimize((value + "3/4"_frac64) * "2/3"_frac64 - "1 1/2"_frac64);
+        }
+    });
+    double integers = measureNsPerOp(values.size(), [&] {
+        for (const Fraction64& value : values) {
+            doNotOptimize((value + Fraction64(std::int64_t(3), std::int64_t(4))) *
+                          Fraction64(std::int64_t(2), std::int64_t(3)) -
+                          Fraction64(std::int64_t(3), std::int64_t(2)));
+        }
+    });
+    std::printf("%s\n", dist.name.c_str());
+    std::printf("  %-22s %8.2f ns/op\n", "string operands", strings);
+    std::printf("  %-22s %8.2f ns/op\n", "_frac64 literals", literals);
+    std::printf("  %-22s %8.2f ns/op\n", "integer constructors", integers);
+    return 0;
+}
@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  bench_loader.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+// Reading a text file of fractions with operator>> (one getline and two istringstream parses
+// per value) against loadFractions (memory-mapped, parsed in parallel chunks).
+
+#include "bench_common.h"
+#include "fraction_loader.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+
+namespace {
+    /// @brief Writes `dist` as text: mostly one "n/d" per line, every 8th line a mixed number,
+    /// every 16th line three comma-separated values.
+    std::size_t writeInput(const std::string& path, const Distribution& dist) {
+        std::ofstream out(path, std::ios::binary);
+        std::size_t values = 0;
+        for (std::size_t i = 0; i < dist.pairs.size(); ++i) {
+            auto [n, d] = dist.pairs[i];
+            if (i % 16 == 0) {
+                out << n << "/" << d << ", " << d << "/" << n << "," << n << "\n";
+                values += 3;
+            } else if (i % 8 == 0) {
+                out << n % 100 << " " << n << "/" << d << "\n";
+                ++values;
+            } else {
+                out << n << "/" << d << "\n";
+                ++values;
+            }
+        }
+        return values;
+    }
+
+    void run(const std::string& path, std::size_t bytes, std::size_t expected) {
+        std::size_t count = 0;
+        double streamSeconds = measureNsPerOp(1, [&] {
+            std::ifstream in(path);
+            count = 0;
+            Fraction64 value;
+            while (in.peek() != std::char_traits<char>::eof()) {
+                try {
+                    in >> value; // one line; the comma-separated ones are rejected
+                    ++count;
+                } catch (const std::exception&) {
+                    in.clear();
+                }
+            }
+            doNotOptimize(count);
+        }, 1.0) / 1e9;
+        std::printf("  %-22s %8.1f M values/s  %6.3f GB/s  (comma lines rejected)\n", "operator>>",
+            static_cast<double>(count) / streamSeconds / 1e6, static_cast<double>(bytes) / streamSeconds / 1e9);
+
+        FracLib::ThreadPool single(1);
+        for (FracLib::ThreadPool* pool : {&single, &FracLib::ThreadPool::shared()}) {
+            FracLib::LoadOptions options;
+            options.pool = pool;
+            FracLib::LoadStats best;
+            measureNsPerOp(1, [&] {
+                auto loaded = FracLib::loadFractions<Fraction64>(path, options);
+                if (loaded.stats.values != expected || !loaded.errors.empty()) throw std::runtime_error("loader mismatch");
+                if (best.seconds == 0.0 || loaded.stats.seconds < best.seconds) best = loaded.stats;
+            }, 1.0);
+            char name[32];
+            std::snprintf(name, sizeof(name), "loadFractions (%zu thr)", pool->size());
+            std::printf("  %-22s %8.1f M values/s  %6.3f GB/s  (%zu chunks)\n", name,
+                best.valuesPerSecond() / 1e6, best.gigabytesPerSecond(), best.chunks);
+        }
+    }
+}
+
+int main() {
+    const std::size_t lines = 1 << 21;
+    const std::string path = "bench_loader_input.txt";
+    for (const Distribution& dist : {randomDistribution(lines), smallDenominatorDistribution(lines)}) {
+        std::size_t expected = writeInput(path, dist);
+        std::ifstream probe(path, std::ios::binary | std::ios::ate);
+        std::size_t bytes = static_cast<std::size_t>(probe.tellg());
+        std::printf("%s (%zu values, %.1f MB)\n", dist.name.c_str(), expected, static_cast<double>(bytes) / 1e6);
+        run(path, bytes, expected);
+    }
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  bench_matrix.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Exact linear systems: Gaussian elimination with fraction operators (a reduction per
+// entry update) against the Bareiss solver, on one thread and on the shared pool.
+// Reports milliseconds per solve and checks the solutions agree.
+
+#include "bench_common.h"
+#include "fraction_matrix.h"
+#include <cstdio>
+#include <stdexcept>
+
+using namespace FracLibBench;
+
+namespace {
+    /// @brief An n x n system with small entries (numerators up to 9, denominators up to 6),
+    /// as in exact geometry and constraint problems.
+    template <typename F>
+    void randomSystem(std::size_t n, FracLib::RationalMatrix<F>& a, std::vector<F>& b, std::uint64_t seed = 19) {
+        std::mt19937_64 rng(seed + n);
+        std::uniform_int_distribution<int> num(-9, 9);
+        std::uniform_int_distribution<int> den(1, 6);
+        a = FracLib::RationalMatrix<F>(n, n);
+        b.assign(n, F());
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) a(i, j) = F(num(rng), den(rng), true);
+            b[i] = F(num(rng), den(rng), true);
+        }
+    }
+
+    /// @brief Gauss-Jordan elimination with the fraction operators.
+    template <typename F>
+    std::vector<F> naiveSolve(FracLib::RationalMatrix<F> a, std::vector<F> b) {
+        std::size_t n = a.rows();
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t p = k;
+            while (a(p, k).numerator == 0) ++p;
+            if (p != k) {
+                for (std::size_t j = 0; j < n; ++j) std::swap(a(p, j), a(k, j));
+                std::swap(b[p], b[k]);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i == k || a(i, k).numerator == 0) continue;
+                F factor = F(a(i, k) / a(k, k));
+                for (std::size_t j = k; j < n; ++j) a(i, j) = F(a(i, j) - factor * a(k, j));
+                b[i] = F(b[i] - factor * b[k]);
+            }
+        }
+        for (std::size_t i = 0; i < n; ++i) b[i] = F(b[i] / a(i, i));
+        return b;
+    }
+
+    template <typename F>
+    void measure(const char* typeName, std::size_t n, FracLib::ThreadPool& single) {
+        FracLib::RationalMatrix<F> a;
+        std::vector<F> b;
+        randomSystem(n, a, b);
+        std::vector<F> expected;
+        try {
+            expected = FracLib::solve(a, b, &single);
+        } catch (const std::overflow_error&) {
+            std::printf("  %-11s n=%-4zu solution does not fit\n", typeName, n);
+            return;
+        }
+
+        char naive[32];
+        try {
+            bool same = naiveSolve(a, b) == expected;
+            double ns = measureNsPerOp(1, [&] { doNotOptimize(naiveSolve(a, b)); });
+            std::snprintf(naive, sizeof(naive), "%9.3f ms%s", ns / 1e6, same ? "" : " (differs)");
+        } catch (const std::overflow_error&) {
+            std::snprintf(naive, sizeof(naive), "%12s", "overflows");
+        }
+        double oneThread = measureNsPerOp(1, [&] { doNotOptimize(FracLib::solve(a, b, &single)); });
+        double pooled = measureNsPerOp(1, [&] { doNotOptimize(FracLib::solve(a, b)); });
+        std::printf("  %-11s n=%-4zu operators %s  Bareiss %9.3f ms  Bareiss (%zu threads) %9.3f ms\n", typeName, n, naive,
+            oneThread / 1e6, FracLib::ThreadPool::shared().size(), pooled / 1e6);
+    }
+}
+
+int main() {
+    FracLib::ThreadPool single(1);
+    std::printf("Solve A x = b (ms per solve)\n");
+    for (std::size_t n : {4, 8, 16}) measure<FracLib::Fraction64>("Fraction64", n, single);
+    for (std::size_t n : {4, 8, 16, 32, 64}) measure<FracLib::BigFraction>("BigFraction", n, single);
+    return 0;
+}
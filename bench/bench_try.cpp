@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  bench_try.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// Error handling in a hot loop: dividing by (and parsing) inputs of which a given share is
+// bad, skipping the bad ones either by catching the operator's exception or by checking the
+// FractionResult of tryDivide / tryParse.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+using namespace FracLibBench;
+using FracLib::Fraction64;
+
+namespace {
+    void run(const Distribution& dist, double badShare) {
+        std::mt19937_64 rng(23);
+        std::bernoulli_distribution bad(badShare);
+        std::vector<Fraction64> values, divisors;
+        std::vector<std::string> texts;
+        values.reserve(dist.pairs.size());
+        divisors.reserve(dist.pairs.size());
+        texts.reserve(dist.pairs.size());
+        for (auto [n, d] : dist.pairs) {
+            bool zero = bad(rng);
+            values.emplace_back(n, d);
+            divisors.emplace_back(zero ? std::int64_t(0) : d, n);
+            texts.push_back(std::to_string(n) + (zero ? "/0" : "/" + std::to_string(d)));
+        }
+
+        std::size_t skipped = 0;
+        double divideCatch = measureNsPerOp(values.size(), [&] {
+            skipped = 0;
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                try {
+                    doNotOptimize(values[i] / divisors[i]);
+                } catch (const std::invalid_argument&) {
+                    ++skipped;
+                }
+            }
+        });
+        double divideTry = measureNsPerOp(values.size(), [&] {
+            skipped = 0;
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                auto result = Fraction64::tryDivide(values[i], divisors[i]);
+                if (result) doNotOptimize(*result); else ++skipped;
+            }
+        });
+        double parseCatch = measureNsPerOp(texts.size(), [&] {
+            for (const std::string& text : texts) {
+                try {
+                    doNotOptimize(Fraction64(std::string_view(text)));
+                } catch (const std::invalid_argument&) {
+                }
+            }
+        });
+        double parseTry = measureNsPerOp(texts.size(), [&] {
+            for (const std::string& text : texts) {
+                auto result = Fraction64::tryParse(text);
+                if (result) doNotOptimize(*result);
+            }
+        });
+        std::printf("%s, %5.1f%% bad (%zu skipped)\n", dist.name.c_str(), badShare * 100, skipped);
+        std::printf("  %-22s %8.2f ns/op\n", "operator/ + catch", divideCatch);
+        std::printf("  %-22s %8.2f ns/op\n", "tryDivide", divideTry);
+        std::printf("  %-22s %8.2f ns/op\n", "string ctor + catch", parseCatch);
+        std::printf("  %-22s %8.2f ns/op\n", "tryParse", parseTry);
+    }
+}
+
+int main() {
+    const std::size_t count = 1 << 16;
+    Distribution dist = smallDenominatorDistribution(count);
+    for (double badShare : {0.0, 0.001, 0.01, 0.1}) {
+        run(dist, badShare);
+    }
+    return 0;
+}
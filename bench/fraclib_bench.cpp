@@ -0,0 +1,330 @@
+/**************************************************************************/
+/*  fraclib_bench.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+// The regression suite for Fraction32 and Fraction64 over the seeded distributions in
+// bench_common.h: construction from integers, doubles and strings; every arithmetic and
+// compound operator with fraction, integer, double and string operands, including integer,
+// double and string left operands; the comparison operators with fraction operands, and ==
+// and < with double and string operands; assignment, conversions and the stream operators.
+// Written as JSON (ns/op and ops/s per type, distribution and operation) so results can be
+// compared between releases.
+//
+//   fraclib_bench [--output FILE] [--min-time SECONDS] [--filter TEXT]
+//
+// Operands whose result does not fit the type are left out before timing, so no exception
+// is ever measured; "overflowed" in the output counts them.
+
+#include "bench_common.h"
+#include "fraction.h"
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+
+#ifndef FRACLIB_VERSION_STRING
+#define FRACLIB_VERSION_STRING "unknown"
+#endif
+
+using namespace FracLibBench;
+
+namespace {
+    struct Options {
+        std::string output;       ///< Empty for stdout.
+        double minSeconds = 0.1;  ///< Per operation.
+        std::string filter;       ///< Only operations whose name contains it.
+    };
+
+    struct Result {
+        std::string type;
+        std::string distribution;
+        std::string operation;
+        std::size_t operands = 0;
+        std::size_t overflowed = 0;
+        double nsPerOp = 0.0;
+    };
+
+    class Suite {
+    public:
+        explicit Suite(const Options& options) : options_(options) {}
+
+        void begin(const char* type, const std::string& distribution) {
+            type_ = type;
+            distribution_ = distribution;
+        }
+
+        /// @brief Times `op(i)` for every i in [0, count) whose result fits.
+        template <typename Op>
+        void measure(const char* operation, std::size_t count, Op op) {
+            if (!selected(operation)) return;
+            indices_.clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                try {
+                    doNotOptimize(op(i));
+                    indices_.push_back(i);
+                } catch (const std::exception&) {
+                }
+            }
+            double ns = 0.0;
+            if (!indices_.empty()) {
+                ns = measureNsPerOp(indices_.size(), [&] {
+                    for (std::size_t i : indices_) doNotOptimize(op(i));
+                }, options_.minSeconds);
+            }
+            record(operation, indices_.size(), count - indices_.size(), ns);
+        }
+
+        /// @brief Times `body()`, which processes `count` values.
+        template <typename Body>
+        void measureBatch(const char* operation, std::size_t count, Body body) {
+            if (!selected(operation)) return;
+            record(operation, count, 0, measureNsPerOp(count, body, options_.minSeconds));
+        }
+
+        void writeJson(std::ostream& out) const {
+            out << "{\n  \"library\": \"FracLib\",\n  \"version\": \"" << FRACLIB_VERSION_STRING << "\",\n";
+            out << "  \"min_seconds\": " << options_.minSeconds << ",\n  \"results\": [";
+            for (std::size_t i = 0; i < results_.size(); ++i) {
+                const Result& r = results_[i];
+                out << (i == 0 ? "\n" : ",\n") << "    {\"type\": \"" << r.type << "\", \"distribution\": \"" << r.distribution
+                    << "\", \"operation\": \"" << r.operation << "\", \"operands\": " << r.operands
+                    << ", \"overflowed\": " << r.overflowed << ", ";
+                if (r.operands == 0) {
+                    out << "\"ns_per_op\": null, \"ops_per_sec\": null}";
+                } else {
+                    out << "\"ns_per_op\": " << r.nsPerOp << ", \"ops_per_sec\": " << 1e9 / r.nsPerOp << "}";
+                }
+            }
+            out << "\n  ]\n}\n";
+        }
+
+    private:
+        bool selected(const char* operation) const {
+            return options_.filter.empty() || std::strstr(operation, options_.filter.c_str()) != nullptr;
+        }
+
+        void record(const char* operation, std::size_t operands, std::size_t overflowed, double ns) {
+            results_.push_back({type_, distribution_, operation, operands, overflowed, ns});
+            if (operands == 0) {
+                std::fprintf(stderr, "%-11s %-18s %-24s %9s (every result overflowed)\n", type_.c_str(), distribution_.c_str(), operation, "skipped");
+            } else {
+                std::fprintf(stderr, "%-11s %-18s %-24s %9.2f ns/op\n", type_.c_str(), distribution_.c_str(), operation, ns);
+            }
+        }
+
+        const Options& options_;
+        std::string type_;
+        std::string distribution_;
+        std::vector<std::size_t> indices_;
+        std::vector<Result> results_;
+    };
+
+    template <typename F>
+    void runType(Suite& suite, const char* typeName, const Distribution& dist) {
+        using I = typename F::value_type;
+        const std::size_t count = dist.pairs.size();
+        std::vector<I> numerators, denominators, integers;
+        std::vector<F> a, b;
+        std::vector<double> doubles, operandDoubles;
+        std::vector<std::string> texts;
+        std::string lines;
+        std::mt19937_64 rng(21);
+        std::uniform_int_distribution<int> small(1, 1000);
+        for (auto [n, d] : dist.pairs) {
+            numerators.push_back(static_cast<I>(n));
+            denominators.push_back(static_cast<I>(d));
+            integers.push_back(static_cast<I>(small(rng)));
+            a.emplace_back(static_cast<I>(n), static_cast<I>(d));
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            b.push_back(a[(i + 1) % count]);
+            doubles.push_back(F::toDouble(b[i]));
+            // Multiples of 1/64: a double such as 0.1 converts to a fraction with a 2^55
+            // denominator, which no 64-bit sum or quotient with a random31 operand can hold
+            operandDoubles.push_back(static_cast<double>(integers[i]) / 64);
+            texts.push_back(F::toString(a[i]));
+            lines += texts[i] + "\n";
+        }
+        suite.begin(typeName, dist.name);
+
+        // Construction
+        suite.measure("construct_int", count, [&](std::size_t i) { return F(numerators[i]); });
+        suite.measure("construct", count, [&](std::size_t i) { return F(numerators[i], denominators[i]); });
+        suite.measure("construct_simplify", count, [&](std::size_t i) { return F(numerators[i], denominators[i], true); });
+        suite.measure("construct_double", count, [&](std::size_t i) { return F(doubles[i]); });
+        suite.measure("construct_double_decimal", count, [&](std::size_t i) { return F(doubles[i], FracLib::DoubleConversion::Decimal); });
+        suite.measure("construct_string", count, [&](std::size_t i) { return F(std::string_view(texts[i])); });
+        suite.measure("construct_cstring", count, [&](std::size_t i) { return F(texts[i].c_str()); });
+        suite.measure("parse", count, [&](std::size_t i) {
+            F out;
+            F::parse(texts[i], out);
+            return out;
+        });
+
+        // Arithmetic, with fraction, integer, double and string operands
+        suite.measure("add", count, [&](std::size_t i) { return a[i] + b[i]; });
+        suite.measure("add_int", count, [&](std::size_t i) { return a[i] + integers[i]; });
+        suite.measure("add_double", count, [&](std::size_t i) { return a[i] + operandDoubles[i]; });
+        suite.measure("subtract", count, [&](std::size_t i) { return a[i] - b[i]; });
+        suite.measure("subtract_int", count, [&](std::size_t i) { return a[i] - integers[i]; });
+        suite.measure("subtract_double", count, [&](std::size_t i) { return a[i] - operandDoubles[i]; });
+        suite.measure("multiply", count, [&](std::size_t i) { return a[i] * b[i]; });
+        suite.measure("multiply_int", count, [&](std::size_t i) { return a[i] * integers[i]; });
+        suite.measure("multiply_double", count, [&](std::size_t i) { return a[i] * operandDoubles[i]; });
+        suite.measure("divide", count, [&](std::size_t i) { return a[i] / b[i]; });
+        suite.measure("divide_int", count, [&](std::size_t i) { return a[i] / integers[i]; });
+        suite.measure("divide_double", count, [&](std::size_t i) { return a[i] / operandDoubles[i]; });
+        suite.measure("add_string", count, [&](std::size_t i) { return a[i] + texts[i].c_str(); });
+        suite.measure("subtract_string", count, [&](std::size_t i) { return a[i] - texts[i].c_str(); });
+        suite.measure("multiply_string", count, [&](std::size_t i) { return a[i] * texts[i].c_str(); });
+        suite.measure("divide_string", count, [&](std::size_t i) { return a[i] / texts[i].c_str(); });
+        suite.measure("negate", count, [&](std::size_t i) { return -a[i]; });
+
+        // Reversed operands: integer, double or string on the left
+        suite.measure("int_add", count, [&](std::size_t i) { return integers[i] + a[i]; });
+        suite.measure("int_subtract", count, [&](std::size_t i) { return integers[i] - a[i]; });
+        suite.measure("int_multiply", count, [&](std::size_t i) { return integers[i] * a[i]; });
+        suite.measure("int_divide", count, [&](std::size_t i) { return integers[i] / a[i]; });
+        suite.measure("double_add", count, [&](std::size_t i) { return operandDoubles[i] + a[i]; });
+        suite.measure("double_subtract", count, [&](std::size_t i) { return operandDoubles[i] - a[i]; });
+        suite.measure("double_multiply", count, [&](std::size_t i) { return operandDoubles[i] * a[i]; });
+        suite.measure("double_divide", count, [&](std::size_t i) { return operandDoubles[i] / a[i]; });
+        suite.measure("string_add", count, [&](std::size_t i) { return texts[i].c_str() + b[i]; });
+        suite.measure("string_subtract", count, [&](std::size_t i) { return texts[i].c_str() - b[i]; });
+        suite.measure("string_multiply", count, [&](std::size_t i) { return texts[i].c_str() * b[i]; });
+        suite.measure("string_divide", count, [&](std::size_t i) { return texts[i].c_str() / b[i]; });
+
+        // Compound assignment, increment and decrement
+        suite.measure("add_assign", count, [&](std::size_t i) { F x = a[i]; x += b[i]; return x; });
+        suite.measure("add_assign_int", count, [&](std::size_t i) { F x = a[i]; x += integers[i]; return x; });
+        suite.measure("add_assign_double", count, [&](std::size_t i) { F x = a[i]; x += operandDoubles[i]; return x; });
+        suite.measure("add_assign_string", count, [&](std::size_t i) { F x = a[i]; x += texts[i].c_str(); return x; });
+        suite.measure("subtract_assign", count, [&](std::size_t i) { F x = a[i]; x -= b[i]; return x; });
+        suite.measure("subtract_assign_int", count, [&](std::size_t i) { F x = a[i]; x -= integers[i]; return x; });
+        suite.measure("subtract_assign_double", count, [&](std::size_t i) { F x = a[i]; x -= operandDoubles[i]; return x; });
+        suite.measure("subtract_assign_string", count, [&](std::size_t i) { F x = a[i]; x -= texts[i].c_str(); return x; });
+        suite.measure("multiply_assign", count, [&](std::size_t i) { F x = a[i]; x *= b[i]; return x; });
+        suite.measure("multiply_assign_int", count, [&](std::size_t i) { F x = a[i]; x *= integers[i]; return x; });
+        suite.measure("multiply_assign_double", count, [&](std::size_t i) { F x = a[i]; x *= operandDoubles[i]; return x; });
+        suite.measure("multiply_assign_string", count, [&](std::size_t i) { F x = a[i]; x *= texts[i].c_str(); return x; });
+        suite.measure("divide_assign", count, [&](std::size_t i) { F x = a[i]; x /= b[i]; return x; });
+        suite.measure("divide_assign_int", count, [&](std::size_t i) { F x = a[i]; x /= integers[i]; return x; });
+        suite.measure("divide_assign_double", count, [&](std::size_t i) { F x = a[i]; x /= operandDoubles[i]; return x; });
+        suite.measure("divide_assign_string", count, [&](std::size_t i) { F x = a[i]; x /= texts[i].c_str(); return x; });
+        suite.measure("increment", count, [&](std::size_t i) { F x = a[i]; ++x; return x; });
+        suite.measure("decrement", count, [&](std::size_t i) { F x = a[i]; --x; return x; });
+
+        // Comparison
+        suite.measure("equal", count, [&](std::size_t i) { return a[i] == b[i]; });
+        suite.measure("not_equal", count, [&](std::size_t i) { return a[i] != b[i]; });
+        suite.measure("less", count, [&](std::size_t i) { return a[i] < b[i]; });
+        suite.measure("less_equal", count, [&](std::size_t i) { return a[i] <= b[i]; });
+        suite.measure("greater", count, [&](std::size_t i) { return a[i] > b[i]; });
+        suite.measure("greater_equal", count, [&](std::size_t i) { return a[i] >= b[i]; });
+        suite.measure("compare", count, [&](std::size_t i) { return F::compare(a[i], b[i]); });
+        suite.measure("equal_double", count, [&](std::size_t i) { return a[i] == doubles[i]; });
+        suite.measure("less_double", count, [&](std::size_t i) { return a[i] < doubles[i]; });
+        suite.measure("equal_string", count, [&](std::size_t i) { return a[i] == texts[i].c_str(); });
+        suite.measure("less_string", count, [&](std::size_t i) { return a[i] < texts[i].c_str(); });
+
+        // Assignment
+        suite.measure("assign_double", count, [&](std::size_t i) { F x; x = doubles[i]; return x; });
+        suite.measure("assign_string", count, [&](std::size_t i) { F x; x = texts[i].c_str(); return x; });
+
+        // Simplification and conversion
+        suite.measure("simplify", count, [&](std::size_t i) { return F::Simplify(a[i]); });
+        suite.measure("reciprocal", count, [&](std::size_t i) { return F::toReciprocal(a[i]); });
+        suite.measure("to_double", count, [&](std::size_t i) { return F::toDouble(a[i]); });
+        suite.measure("to_string", count, [&](std::size_t i) { return F::toString(a[i]).size(); });
+
+        // Streams
+        suite.measureBatch("stream_out", count, [&] {
+            std::ostringstream out;
+            for (const F& value : a) out << value << '\n';
+            doNotOptimize(out.tellp());
+        });
+        suite.measureBatch("stream_in", count, [&] {
+            std::istringstream in(lines);
+            F value;
+            for (std::size_t i = 0; i < count; ++i) {
+                in >> value;
+                doNotOptimize(value);
+            }
+        });
+    }
+
+    bool parseOptions(int argc, char** argv, Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            if (i + 1 < argc && arg == "--output") {
+                options.output = argv[++i];
+            } else if (i + 1 < argc && arg == "--min-time") {
+                options.minSeconds = std::atof(argv[++i]);
+            } else if (i + 1 < argc && arg == "--filter") {
+                options.filter = argv[++i];
+            } else {
+                return false;
+            }
+        }
+        return options.minSeconds > 0.0;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: %s [--output FILE] [--min-time SECONDS] [--filter TEXT]\n", argv[0]);
+        return 2;
+    }
+
+    const std::size_t count = 4096; // operands stay in cache
+    Suite suite(options);
+    for (const Distribution& dist : {smallDenominatorDistribution(count), powerOfTenDistribution(count)}) {
+        runType<FracLib::Fraction32>(suite, "Fraction32", dist);
+        runType<FracLib::Fraction64>(suite, "Fraction64", dist);
+    }
+    // Sums and products of two random 31-bit fractions never fit in 32 bits, so Fraction32
+    // gets 15-bit components, whose cross products do
+    runType<FracLib::Fraction32>(suite, "Fraction32", randomDistribution(count, 15));
+    runType<FracLib::Fraction64>(suite, "Fraction64", randomDistribution(count));
+
+    if (options.output.empty()) {
+        suite.writeJson(std::cout);
+    } else {
+        std::ofstream out(options.output);
+        suite.writeJson(out);
+        if (!out) {
+            std::fprintf(stderr, "cannot write %s\n", options.output.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
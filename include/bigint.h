@@ -0,0 +1,283 @@
+/**************************************************************************/
+/*  bigint.h                                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "fraction_traits.h"
+#include "fraction_gcd.h"
+
+namespace FracLib {
+    /// @brief Arbitrary-precision signed integer, usable as the storage type of a fraction
+    /// (`BigFraction`). Values that fit in `int64_t` are stored inline and their arithmetic
+    /// never allocates; larger values spill to heap limbs (least significant first).
+    /// Multiplication switches to Karatsuba above KARATSUBA_THRESHOLD limbs and gcd() uses
+    /// Lehmer's algorithm. Division truncates toward zero, like the built-in types.
+    class BigInt {
+    public:
+#ifdef FRACLIB_HAS_INT128
+        using limb_type = std::uint64_t;
+        using double_limb_type = uint128_t;
+#else
+        using limb_type = std::uint32_t;
+        using double_limb_type = std::uint64_t;
+#endif
+        static constexpr int LIMB_BITS = static_cast<int>(sizeof(limb_type) * 8);
+        /// @brief Operands with at least this many limbs are multiplied with Karatsuba.
+        static constexpr std::size_t KARATSUBA_THRESHOLD = 32;
+
+        static constexpr const char* INVALID_STRING_ERROR = "Improper format. Accepted integer form: (ie \"-42\").";
+        static constexpr const char* ZERO_DIVISOR_ERROR = "Division by zero not allowed.";
+
+    public: // CONSTRUCTORS
+        /// @brief Initializes to 0.
+        BigInt() noexcept : limbs_(nullptr), small_(0), size_(0), capacity_(0) {}
+        /// @brief Converts any built-in integer, including `__int128`.
+        /// @example BigInt b = 42;
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        BigInt(I value) : limbs_(nullptr), small_(0), size_(0), capacity_(0) {
+            if (!detail::convertOverflow(value, small_)) return;
+            auto mag = detail::magnitude(value);
+            if constexpr (sizeof(mag) > sizeof(std::uint64_t)) {
+                assignMagnitude(value < 0, static_cast<std::uint64_t>(mag), static_cast<std::uint64_t>(mag >> 64));
+            } else {
+                assignMagnitude(value < 0, static_cast<std::uint64_t>(mag), 0);
+            }
+        }
+        /// @brief Integer part of `value` (truncated toward zero).
+        /// @throws std::overflow_error If `value` is infinite or NaN.
+        explicit BigInt(double value);
+        /// @brief Parses an optionally signed run of decimal digits.
+        /// @throws std::invalid_argument If the text is not an integer.
+        /// @example BigInt b("123456789012345678901234567890");
+        explicit BigInt(std::string_view digits);
+        BigInt(const BigInt& other);
+        BigInt(BigInt&& other) noexcept;
+        BigInt& operator=(const BigInt& other);
+        BigInt& operator=(BigInt&& other) noexcept;
+        ~BigInt();
+
+    public: // METHODS
+        /// @brief True while the value is stored inline (it fits in `int64_t`).
+        bool isSmall() const noexcept { return limbs_ == nullptr; }
+        bool isZero() const noexcept { return isSmall() && small_ == 0; }
+        bool isNegative() const noexcept { return isSmall() ? small_ < 0 : size_ < 0; }
+        /// @brief -1, 0 or 1.
+        int sign() const noexcept { return isNegative() ? -1 : (isZero() ? 0 : 1); }
+        /// @brief Number of bits of |value| (0 for 0).
+        std::size_t bitWidth() const noexcept;
+        /// @brief Number of heap limbs in use (0 while stored inline).
+        std::size_t limbCount() const noexcept { return isSmall() ? 0 : static_cast<std::size_t>(size_ < 0 ? -size_ : size_); }
+
+        /// @brief Stores the value in `result` if it fits.
+        /// @return False, leaving `result` unchanged, if it does not.
+        template <typename T>
+        bool tryConvert(T& result) const noexcept {
+            if (isSmall()) return !detail::convertOverflow(small_, result);
+            using U = detail::UnsignedOfT<T>;
+            constexpr std::size_t width = sizeof(U) * 8;
+            if (bitWidth() > width) return false;
+            U mag = 0;
+            for (std::size_t i = 0; i < limbCount(); ++i) {
+                mag = static_cast<U>(mag | static_cast<U>(static_cast<U>(limbs_[i]) << (i * LIMB_BITS)));
+            }
+            constexpr bool isSigned = static_cast<T>(-1) < static_cast<T>(0);
+            if constexpr (isSigned) {
+                const U limit = static_cast<U>(detail::signedMax<T>());
+                if (isNegative() ? mag > static_cast<U>(limit + 1) : mag > limit) return false;
+                result = isNegative() ? static_cast<T>(U(0) - mag) : static_cast<T>(mag);
+            } else {
+                if (isNegative()) return false;
+                result = static_cast<T>(mag);
+            }
+            return true;
+        }
+
+        /// @brief Nearest double (truncated to 64 significant bits first). Values beyond
+        /// double's range become +/-infinity.
+        explicit operator double() const noexcept;
+        /// @brief Decimal representation, with a leading '-' when negative.
+        std::string toString() const;
+
+    public: // OPERATORS
+        // The inline/inline case is handled here and never allocates; anything that overflows
+        // `int64_t` or involves heap limbs goes to the out-of-line limb arithmetic.
+        friend BigInt operator+(const BigInt& a, const BigInt& b) {
+            std::int64_t r;
+            if (a.isSmall() && b.isSmall() && !__builtin_add_overflow(a.small_, b.small_, &r)) return BigInt(r);
+            return addLarge(a, b, false);
+        }
+        friend BigInt operator-(const BigInt& a, const BigInt& b) {
+            std::int64_t r;
+            if (a.isSmall() && b.isSmall() && !__builtin_sub_overflow(a.small_, b.small_, &r)) return BigInt(r);
+            return addLarge(a, b, true);
+        }
+        friend BigInt operator*(const BigInt& a, const BigInt& b) {
+            std::int64_t r;
+            if (a.isSmall() && b.isSmall() && !__builtin_mul_overflow(a.small_, b.small_, &r)) return BigInt(r);
+            return multiplyLarge(a, b);
+        }
+        /// @throws std::invalid_argument If `b` is zero.
+        friend BigInt operator/(const BigInt& a, const BigInt& b) {
+            if (a.isSmall() && b.isSmall() && b.small_ != 0 && (b.small_ != -1 || a.small_ != INT64_MIN)) return BigInt(a.small_ / b.small_);
+            return divideLarge(a, b, false);
+        }
+        /// @throws std::invalid_argument If `b` is zero.
+        friend BigInt operator%(const BigInt& a, const BigInt& b) {
+            if (a.isSmall() && b.isSmall() && b.small_ != 0 && (b.small_ != -1 || a.small_ != INT64_MIN)) return BigInt(a.small_ % b.small_);
+            return divideLarge(a, b, true);
+        }
+        BigInt operator-() const;
+        /// @brief Multiplies by 2^shift.
+        friend BigInt operator<<(const BigInt& a, std::size_t shift);
+        /// @brief Divides by 2^shift, rounding toward negative infinity like `>>` on built-ins.
+        friend BigInt operator>>(const BigInt& a, std::size_t shift);
+
+        BigInt& operator+=(const BigInt& other) { return *this = *this + other; }
+        BigInt& operator-=(const BigInt& other) { return *this = *this - other; }
+        BigInt& operator*=(const BigInt& other) { return *this = *this * other; }
+        BigInt& operator/=(const BigInt& other) { return *this = *this / other; }
+        BigInt& operator%=(const BigInt& other) { return *this = *this % other; }
+        BigInt& operator<<=(std::size_t shift) { return *this = *this << shift; }
+        BigInt& operator>>=(std::size_t shift) { return *this = *this >> shift; }
+
+        friend bool operator==(const BigInt& a, const BigInt& b) noexcept {
+            if (a.isSmall() || b.isSmall()) return a.isSmall() && b.isSmall() && a.small_ == b.small_;
+            return compareLarge(a, b) == 0;
+        }
+        friend bool operator!=(const BigInt& a, const BigInt& b) noexcept { return !(a == b); }
+        friend bool operator<(const BigInt& a, const BigInt& b) noexcept {
+            if (a.isSmall() && b.isSmall()) return a.small_ < b.small_;
+            return compareLarge(a, b) < 0;
+        }
+        friend bool operator>(const BigInt& a, const BigInt& b) noexcept { return b < a; }
+        friend bool operator<=(const BigInt& a, const BigInt& b) noexcept { return !(b < a); }
+        friend bool operator>=(const BigInt& a, const BigInt& b) noexcept { return !(a < b); }
+
+        friend std::ostream& operator<<(std::ostream& os, const BigInt& value);
+
+        /// @brief Greatest Common Divisor of |a| and |b| (Lehmer's algorithm, finishing with
+        /// the binary GCD once both fit in a limb). `gcd(0, 0)` is 0.
+        friend BigInt gcd(const BigInt& a, const BigInt& b);
+        /// @brief n / d as a double without overflowing on components beyond double's range.
+        friend double ratioToDouble(const BigInt& n, const BigInt& d) noexcept;
+
+    private:
+        struct LimbView {
+            const limb_type* data;
+            std::size_t size;
+        };
+        /// @brief |value| as limbs. Inline values are written to `scratch`.
+        LimbView view(limb_type (&scratch)[2]) const noexcept;
+        void assignMagnitude(bool negative, std::uint64_t low, std::uint64_t high);
+        void assignLimbs(bool negative, const limb_type* limbs, std::size_t size);
+        void release() noexcept;
+
+        static BigInt addLarge(const BigInt& a, const BigInt& b, bool subtract);
+        static BigInt multiplyLarge(const BigInt& a, const BigInt& b);
+        static BigInt divideLarge(const BigInt& a, const BigInt& b, bool remainder);
+        static int compareLarge(const BigInt& a, const BigInt& b) noexcept;
+
+        limb_type* limbs_;       // |value|, least significant first; nullptr while inline
+        std::int64_t small_;     // the value while inline
+        std::int32_t size_;      // limbs in use, negated for negative values
+        std::uint32_t capacity_; // limbs allocated
+    };
+
+    /// @brief BigInt never overflows, so intermediates need no wider type and no range checks.
+    template <>
+    struct FractionTraits<BigInt> {
+        using value_type = BigInt;
+        using wide_type = BigInt;
+        static constexpr bool has_wider = true;
+        static constexpr bool is_bounded = false;
+    };
+}
+
+#include "fraction.h"
+
+namespace FracLib {
+    /// @brief Arbitrary-precision fraction. Supports the full operator set of Fraction and
+    /// never overflows; small values stay allocation-free.
+    using BigFraction = BasicFraction<BigInt>;
+
+    namespace detail {
+        /// @brief n/d (d nonzero) in lowest terms as a `FractionT`. Built-in types narrow through
+        /// their overflow policy; values far outside the wide type keep only their leading bits,
+        /// which is all a policy needs to saturate or report them.
+        template <typename FractionT>
+        FractionT narrowBigFraction(BigInt n, BigInt d) {
+            using IntT = typename FractionT::value_type;
+            if constexpr (!FractionTraits<IntT>::is_bounded) {
+                return FractionT(std::move(n), std::move(d), true);
+            } else {
+                using W = typename FractionTraits<IntT>::wide_type;
+                if (d.isNegative()) {
+                    n = -n;
+                    d = -d;
+                }
+                BigInt g = gcd(n, d);
+                n /= g;
+                d /= g;
+                W wn = 0, wd = 1;
+                bool approximated = !n.tryConvert(wn) || !d.tryConvert(wd);
+                if (approximated) {
+                    bool negative = n.isNegative();
+                    if (negative) n = -n;
+                    constexpr std::size_t bits = sizeof(W) * 8 - 2;
+                    std::size_t width = std::max(n.bitWidth(), d.bitWidth());
+                    n >>= width - bits;
+                    d >>= width - bits;
+                    if (d.isZero()) d = 1;
+                    if (negative) n = -n;
+                    n.tryConvert(wn);
+                    d.tryConvert(wd);
+                }
+                // An approximation fits when W is IntT itself, but is still the policy's to handle
+                IntT tn = 0, td = 0;
+                if (!(convertOverflow(wn, tn) | convertOverflow(wd, td) | approximated)) return FractionT(tn, td);
+                return FractionT::policy_type::template narrowFraction<FractionT>(wn, wd);
+            }
+        }
+    }
+
+#ifndef FRACLIB_HEADER_ONLY
+    // Instantiated once in the Fraction library (src/bigint.cpp).
+    extern template class BasicFraction<BigInt>;
+#endif
+}
+
+#ifdef FRACLIB_HEADER_ONLY
+#include "bigint_impl.h"
+#endif
@@ -0,0 +1,691 @@
+/**************************************************************************/
+/*  bigint_impl.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+// Out-of-line definitions for BigInt. Compiled by src/bigint.cpp, or included by bigint.h in
+// header-only mode; do not include directly.
+#include <cmath>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Limb Arithmetic
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Magnitudes are little-endian limb arrays. Results are written to std::vector and trimmed
+    // of leading zero limbs by the caller (BigInt::assignLimbs).
+    namespace detail {
+        using Limb = BigInt::limb_type;
+        using DoubleLimb = BigInt::double_limb_type;
+        using Limbs = std::vector<Limb>;
+        constexpr int LIMB_BITS = BigInt::LIMB_BITS;
+
+        FRACLIB_INLINE std::size_t trimmedSize(const Limb* a, std::size_t n) noexcept {
+            while (n > 0 && a[n - 1] == 0) --n;
+            return n;
+        }
+
+        FRACLIB_INLINE int compareLimbs(const Limb* a, std::size_t an, const Limb* b, std::size_t bn) noexcept {
+            if (an != bn) return an < bn ? -1 : 1;
+            for (std::size_t i = an; i-- > 0;) {
+                if (a[i] != b[i]) return a[i] < b[i] ? -1 : 1;
+            }
+            return 0;
+        }
+
+        /// @brief dst[0..dn) += src[0..sn), sn <= dn. Returns the carry out of dst.
+        FRACLIB_INLINE Limb addInto(Limb* dst, std::size_t dn, const Limb* src, std::size_t sn) noexcept {
+            Limb carry = 0;
+            std::size_t i = 0;
+            for (; i < sn; ++i) {
+                Limb sum = static_cast<Limb>(dst[i] + src[i]);
+                Limb c1 = sum < dst[i];
+                dst[i] = static_cast<Limb>(sum + carry);
+                carry = static_cast<Limb>(c1 | (dst[i] < carry));
+            }
+            for (; carry != 0 && i < dn; ++i) {
+                dst[i] = static_cast<Limb>(dst[i] + 1);
+                carry = dst[i] == 0;
+            }
+            return carry;
+        }
+
+        /// @brief dst[0..dn) -= src[0..sn), requires dst >= src.
+        FRACLIB_INLINE void subtractFrom(Limb* dst, std::size_t dn, const Limb* src, std::size_t sn) noexcept {
+            Limb borrow = 0;
+            std::size_t i = 0;
+            for (; i < sn; ++i) {
+                Limb d = static_cast<Limb>(dst[i] - src[i]);
+                Limb b1 = dst[i] < src[i];
+                dst[i] = static_cast<Limb>(d - borrow);
+                borrow = static_cast<Limb>(b1 | (d < borrow));
+            }
+            for (; borrow != 0 && i < dn; ++i) {
+                borrow = dst[i] == 0;
+                dst[i] = static_cast<Limb>(dst[i] - 1);
+            }
+        }
+
+        FRACLIB_INLINE void schoolbookMultiply(const Limb* a, std::size_t an, const Limb* b, std::size_t bn, Limb* out) noexcept {
+            std::fill(out, out + an + bn, Limb(0));
+            for (std::size_t i = 0; i < an; ++i) {
+                Limb carry = 0;
+                DoubleLimb ai = a[i];
+                for (std::size_t j = 0; j < bn; ++j) {
+                    DoubleLimb t = ai * b[j] + out[i + j] + carry;
+                    out[i + j] = static_cast<Limb>(t);
+                    carry = static_cast<Limb>(t >> LIMB_BITS);
+                }
+                out[i + bn] = carry;
+            }
+        }
+
+        /// @brief out[0..an+bn) = a * b. Karatsuba splits the larger operand in half:
+        /// a*b = z2*B^2m + ((a0+a1)(b0+b1) - z0 - z2)*B^m + z0, three half-size products
+        /// instead of four.
+        FRACLIB_INLINE void multiplyLimbs(const Limb* a, std::size_t an, const Limb* b, std::size_t bn, Limb* out) {
+            if (an < bn) {
+                std::swap(a, b);
+                std::swap(an, bn);
+            }
+            if (bn < BigInt::KARATSUBA_THRESHOLD) {
+                schoolbookMultiply(a, an, b, bn, out);
+                return;
+            }
+            std::fill(out, out + an + bn, Limb(0));
+            if (an >= 2 * bn) {
+                // Unbalanced: multiply bn-sized slices of a
+                Limbs partial(2 * bn);
+                for (std::size_t offset = 0; offset < an; offset += bn) {
+                    std::size_t length = std::min(bn, an - offset);
+                    multiplyLimbs(a + offset, length, b, bn, partial.data());
+                    addInto(out + offset, an + bn - offset, partial.data(), length + bn);
+                }
+                return;
+            }
+
+            std::size_t m = an / 2; // bn > m since an < 2 * bn
+            const Limb* a0 = a;
+            const Limb* a1 = a + m;
+            const Limb* b0 = b;
+            const Limb* b1 = b + m;
+            std::size_t a1n = an - m, b1n = bn - m;
+
+            Limbs z0(2 * m), z2(a1n + b1n);
+            multiplyLimbs(a0, m, b0, m, z0.data());
+            multiplyLimbs(a1, a1n, b1, b1n, z2.data());
+
+            // b1 may be shorter than b0 (m <= a1n always holds)
+            Limbs sa(a1n + 1, 0), sb(std::max(m, b1n) + 1, 0);
+            std::copy(a1, a1 + a1n, sa.begin());
+            sa[a1n] = addInto(sa.data(), a1n, a0, m);
+            std::copy(b0, b0 + m, sb.begin());
+            sb[sb.size() - 1] = addInto(sb.data(), sb.size() - 1, b1, b1n);
+
+            Limbs z1(sa.size() + sb.size());
+            multiplyLimbs(sa.data(), sa.size(), sb.data(), sb.size(), z1.data());
+            subtractFrom(z1.data(), z1.size(), z0.data(), z0.size());
+            subtractFrom(z1.data(), z1.size(), z2.data(), z2.size());
+
+            std::copy(z0.begin(), z0.end(), out);
+            std::copy(z2.begin(), z2.end(), out + 2 * m);
+            addInto(out + m, an + bn - m, z1.data(), trimmedSize(z1.data(), z1.size()));
+        }
+
+        /// @brief a[0..n) /= d in place, returns the remainder.
+        FRACLIB_INLINE Limb divideBySingle(Limb* a, std::size_t n, Limb d) noexcept {
+            DoubleLimb remainder = 0;
+            for (std::size_t i = n; i-- > 0;) {
+                DoubleLimb current = (remainder << LIMB_BITS) | a[i];
+                a[i] = static_cast<Limb>(current / d);
+                remainder = current % d;
+            }
+            return static_cast<Limb>(remainder);
+        }
+
+        /// @brief a[0..n) = a * m + add in place, returns the carry.
+        FRACLIB_INLINE Limb multiplyAddSingle(Limb* a, std::size_t n, Limb m, Limb add) noexcept {
+            Limb carry = add;
+            for (std::size_t i = 0; i < n; ++i) {
+                DoubleLimb t = static_cast<DoubleLimb>(a[i]) * m + carry;
+                a[i] = static_cast<Limb>(t);
+                carry = static_cast<Limb>(t >> LIMB_BITS);
+            }
+            return carry;
+        }
+
+        FRACLIB_INLINE int countLeadingZeros(Limb value) noexcept {
+            if constexpr (sizeof(Limb) == sizeof(unsigned long long)) {
+                return __builtin_clzll(value);
+            } else {
+                return __builtin_clz(value);
+            }
+        }
+
+        /// @brief Knuth's Algorithm D (TAOCP 4.3.1): q = u / v, r = u % v for v with at
+        /// least two limbs and u >= v.
+        FRACLIB_INLINE void divideLimbs(const Limb* u, std::size_t m, const Limb* v, std::size_t n, Limbs& q, Limbs& r) {
+            const DoubleLimb base = DoubleLimb(1) << LIMB_BITS;
+            int s = countLeadingZeros(v[n - 1]);
+            Limbs vn(n), un(m + 1);
+            for (std::size_t i = n; i-- > 0;) {
+                vn[i] = static_cast<Limb>(v[i] << s);
+                if (s != 0 && i > 0) vn[i] |= static_cast<Limb>(v[i - 1] >> (LIMB_BITS - s));
+            }
+            un[m] = s != 0 ? static_cast<Limb>(u[m - 1] >> (LIMB_BITS - s)) : 0;
+            for (std::size_t i = m; i-- > 0;) {
+                un[i] = static_cast<Limb>(u[i] << s);
+                if (s != 0 && i > 0) un[i] |= static_cast<Limb>(u[i - 1] >> (LIMB_BITS - s));
+            }
+
+            q.assign(m - n + 1, 0);
+            for (std::size_t j = m - n + 1; j-- > 0;) {
+                DoubleLimb numerator = (static_cast<DoubleLimb>(un[j + n]) << LIMB_BITS) | un[j + n - 1];
+                DoubleLimb qhat = numerator / vn[n - 1];
+                DoubleLimb rhat = numerator % vn[n - 1];
+                while (qhat >= base || qhat * vn[n - 2] > ((rhat << LIMB_BITS) | un[j + n - 2])) {
+                    --qhat;
+                    rhat += vn[n - 1];
+                    if (rhat >= base) break;
+                }
+
+                // un[j..j+n] -= qhat * vn
+                Limb borrow = 0, carry = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    DoubleLimb product = qhat * vn[i] + carry;
+                    carry = static_cast<Limb>(product >> LIMB_BITS);
+                    Limb low = static_cast<Limb>(product);
+                    Limb d = static_cast<Limb>(un[i + j] - low);
+                    Limb b1 = un[i + j] < low;
+                    un[i + j] = static_cast<Limb>(d - borrow);
+                    borrow = static_cast<Limb>(b1 | (d < borrow));
+                }
+                Limb top = static_cast<Limb>(un[j + n] - carry);
+                Limb b1 = un[j + n] < carry;
+                un[j + n] = static_cast<Limb>(top - borrow);
+                if (b1 | (top < borrow)) {
+                    // qhat was one too large, add v back
+                    --qhat;
+                    un[j + n] = static_cast<Limb>(un[j + n] + addInto(un.data() + j, n, vn.data(), n));
+                }
+                q[j] = static_cast<Limb>(qhat);
+            }
+
+            r.assign(n, 0);
+            for (std::size_t i = 0; i < n; ++i) {
+                r[i] = static_cast<Limb>(un[i] >> s);
+                if (s != 0) r[i] |= static_cast<Limb>(un[i + 1] << (LIMB_BITS - s));
+            }
+        }
+
+        /// @brief q = u / v and r = u % v for any non-zero v.
+        FRACLIB_INLINE void divideMagnitudes(const Limb* u, std::size_t un, const Limb* v, std::size_t vn, Limbs& q, Limbs& r) {
+            if (compareLimbs(u, un, v, vn) < 0) {
+                q.clear();
+                r.assign(u, u + un);
+            } else if (vn == 1) {
+                q.assign(u, u + un);
+                r.assign(1, divideBySingle(q.data(), un, v[0]));
+            } else {
+                divideLimbs(u, un, v, vn, q, r);
+            }
+        }
+
+        /// @brief 64 bits of a starting at bit `shift`.
+        FRACLIB_INLINE std::uint64_t bitsAt(const Limb* a, std::size_t n, std::size_t shift) noexcept {
+            std::uint64_t result = 0;
+            std::size_t index = shift / LIMB_BITS;
+            int offset = static_cast<int>(shift % LIMB_BITS);
+            for (int k = 0; index + k < n && k * LIMB_BITS - offset < 64; ++k) {
+                int position = k * LIMB_BITS - offset;
+                Limb limb = a[index + k];
+                result |= position >= 0 ? static_cast<std::uint64_t>(limb) << position
+                                        : static_cast<std::uint64_t>(limb >> -position);
+            }
+            return result;
+        }
+
+        FRACLIB_INLINE std::size_t bitWidthOf(const Limb* a, std::size_t n) noexcept {
+            n = trimmedSize(a, n);
+            return n == 0 ? 0 : (n - 1) * LIMB_BITS + static_cast<std::size_t>(bitWidth(a[n - 1]));
+        }
+
+        /// @brief x * cx + y * cy for Lehmer cofactors (one of them may be negative; the
+        /// result is not).
+        FRACLIB_INLINE Limbs combineLimbs(const Limbs& x, std::int64_t cx, const Limbs& y, std::int64_t cy) {
+            Limbs px(x.size() + 2), py(y.size() + 2);
+            std::uint64_t mx = magnitude(cx), my = magnitude(cy);
+            Limb fx[2] = {static_cast<Limb>(mx), LIMB_BITS < 64 ? static_cast<Limb>(mx >> (LIMB_BITS % 64)) : Limb(0)};
+            Limb fy[2] = {static_cast<Limb>(my), LIMB_BITS < 64 ? static_cast<Limb>(my >> (LIMB_BITS % 64)) : Limb(0)};
+            std::size_t fxn = trimmedSize(fx, 2), fyn = trimmedSize(fy, 2);
+            std::fill(px.begin(), px.end(), Limb(0));
+            std::fill(py.begin(), py.end(), Limb(0));
+            if (fxn != 0) schoolbookMultiply(x.data(), x.size(), fx, fxn, px.data());
+            if (fyn != 0) schoolbookMultiply(y.data(), y.size(), fy, fyn, py.data());
+            if ((cx >= 0) == (cy >= 0)) {
+                addInto(px.data(), px.size(), py.data(), trimmedSize(py.data(), py.size()));
+                px.resize(trimmedSize(px.data(), px.size()));
+                return px;
+            }
+            Limbs& plus = cx >= 0 ? px : py;
+            Limbs& minus = cx >= 0 ? py : px;
+            subtractFrom(plus.data(), plus.size(), minus.data(), trimmedSize(minus.data(), minus.size()));
+            plus.resize(trimmedSize(plus.data(), plus.size()));
+            return std::move(plus);
+        }
+
+        /// @brief Lehmer's GCD (TAOCP 4.5.2, Algorithm L): runs Euclid on the leading 62 bits
+        /// of both operands with single-word cofactors, then applies the cofactors to the full
+        /// numbers at once, replacing many multi-limb divisions with one linear combination.
+        FRACLIB_INLINE Limbs lehmerGcd(Limbs a, Limbs b) {
+            if (compareLimbs(a.data(), a.size(), b.data(), b.size()) < 0) std::swap(a, b);
+            Limbs q, r;
+            while (bitWidthOf(b.data(), b.size()) > 64) {
+                std::size_t width = bitWidthOf(a.data(), a.size());
+                if (width - bitWidthOf(b.data(), b.size()) >= 62) {
+                    // Too far apart for a single-word step
+                    divideMagnitudes(a.data(), a.size(), b.data(), b.size(), q, r);
+                    r.resize(trimmedSize(r.data(), r.size()));
+                    a.swap(b);
+                    b.swap(r);
+                    continue;
+                }
+                std::size_t shift = width > 62 ? width - 62 : 0;
+                std::int64_t ahat = static_cast<std::int64_t>(bitsAt(a.data(), a.size(), shift));
+                std::int64_t bhat = static_cast<std::int64_t>(bitsAt(b.data(), b.size(), shift));
+                std::int64_t A = 1, B = 0, C = 0, D = 1;
+                while (bhat + C != 0 && bhat + D != 0) {
+                    std::int64_t q1 = (ahat + A) / (bhat + C);
+                    std::int64_t q2 = (ahat + B) / (bhat + D);
+                    if (q1 != q2) break;
+                    std::int64_t t = A - q1 * C; A = C; C = t;
+                    t = B - q1 * D; B = D; D = t;
+                    t = ahat - q1 * bhat; ahat = bhat; bhat = t;
+                }
+                if (B == 0) {
+                    divideMagnitudes(a.data(), a.size(), b.data(), b.size(), q, r);
+                    r.resize(trimmedSize(r.data(), r.size()));
+                    a.swap(b);
+                    b.swap(r);
+                } else {
+                    Limbs na = combineLimbs(a, A, b, B);
+                    Limbs nb = combineLimbs(a, C, b, D);
+                    a.swap(na);
+                    b.swap(nb);
+                }
+            }
+            if (b.empty()) return a;
+
+            // b fits in 64 bits: one division brings a down too, then the word-sized GCD
+            std::uint64_t small = bitsAt(b.data(), b.size(), 0);
+            Limbs divisor(b);
+            divideMagnitudes(a.data(), a.size(), divisor.data(), divisor.size(), q, r);
+            std::uint64_t rest = bitsAt(r.data(), trimmedSize(r.data(), r.size()), 0);
+            std::uint64_t g = gcdMagnitude(small, rest);
+            Limbs result;
+            for (; g != 0; g = LIMB_BITS < 64 ? g >> (LIMB_BITS % 64) : 0) result.push_back(static_cast<Limb>(g));
+            return result;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigInt::BigInt(double value) : limbs_(nullptr), small_(0), size_(0), capacity_(0) {
+        if (!std::isfinite(value)) {
+            detail::throwError(std::overflow_error(detail::overflowErrorMessage));
+        }
+        value = std::trunc(value);
+        if (std::fabs(value) < 9223372036854775808.0) { // 2^63
+            small_ = static_cast<std::int64_t>(value);
+            return;
+        }
+        int exponent = 0;
+        double fraction = std::frexp(std::fabs(value), &exponent); // [0.5, 1), exponent >= 64
+        BigInt mantissa(static_cast<std::uint64_t>(std::ldexp(fraction, 64)));
+        *this = mantissa << static_cast<std::size_t>(exponent - 64);
+        if (value < 0) *this = -*this;
+    }
+
+    FRACLIB_INLINE BigInt::BigInt(std::string_view digits) : limbs_(nullptr), small_(0), size_(0), capacity_(0) {
+        bool negative = !digits.empty() && digits[0] == '-';
+        if (negative || (!digits.empty() && digits[0] == '+')) digits.remove_prefix(1);
+        if (digits.empty()) {
+            detail::throwError(std::invalid_argument(INVALID_STRING_ERROR));
+        }
+        // Accumulate 9 digits at a time: value = value * 10^9 + chunk
+        detail::Limbs limbs;
+        std::size_t i = 0;
+        std::size_t chunk = digits.size() % 9 == 0 ? 9 : digits.size() % 9;
+        while (i < digits.size()) {
+            std::uint32_t part = 0, scale = 1;
+            for (std::size_t end = i + chunk; i < end; ++i) {
+                char c = digits[i];
+                if (c < '0' || c > '9') {
+                    detail::throwError(std::invalid_argument(INVALID_STRING_ERROR));
+                }
+                part = part * 10 + static_cast<std::uint32_t>(c - '0');
+                scale *= 10;
+            }
+            detail::Limb carry = detail::multiplyAddSingle(limbs.data(), limbs.size(), scale, part);
+            if (carry != 0) limbs.push_back(carry);
+            chunk = 9;
+        }
+        assignLimbs(negative, limbs.data(), limbs.size());
+    }
+
+    FRACLIB_INLINE BigInt::BigInt(const BigInt& other) : limbs_(nullptr), small_(other.small_), size_(0), capacity_(0) {
+        if (!other.isSmall()) {
+            assignLimbs(other.size_ < 0, other.limbs_, other.limbCount());
+        }
+    }
+
+    FRACLIB_INLINE BigInt::BigInt(BigInt&& other) noexcept
+        : limbs_(other.limbs_), small_(other.small_), size_(other.size_), capacity_(other.capacity_) {
+        other.limbs_ = nullptr;
+        other.small_ = 0;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    FRACLIB_INLINE BigInt& BigInt::operator=(const BigInt& other) {
+        if (this == &other) return *this;
+        if (other.isSmall()) {
+            release();
+            small_ = other.small_;
+        } else {
+            assignLimbs(other.size_ < 0, other.limbs_, other.limbCount());
+        }
+        return *this;
+    }
+
+    FRACLIB_INLINE BigInt& BigInt::operator=(BigInt&& other) noexcept {
+        if (this == &other) return *this;
+        release();
+        limbs_ = other.limbs_;
+        small_ = other.small_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.limbs_ = nullptr;
+        other.small_ = 0;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        return *this;
+    }
+
+    FRACLIB_INLINE BigInt::~BigInt() {
+        release();
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Storage
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE void BigInt::release() noexcept {
+        delete[] limbs_;
+        limbs_ = nullptr;
+        small_ = 0;
+        size_ = 0;
+        capacity_ = 0;
+    }
+
+    FRACLIB_INLINE BigInt::LimbView BigInt::view(limb_type (&scratch)[2]) const noexcept {
+        if (!isSmall()) return LimbView{limbs_, limbCount()};
+        std::uint64_t mag = detail::magnitude(small_);
+        scratch[0] = static_cast<limb_type>(mag);
+        scratch[1] = LIMB_BITS < 64 ? static_cast<limb_type>(mag >> (LIMB_BITS % 64)) : limb_type(0);
+        return LimbView{scratch, detail::trimmedSize(scratch, 2)};
+    }
+
+    FRACLIB_INLINE void BigInt::assignMagnitude(bool negative, std::uint64_t low, std::uint64_t high) {
+        limb_type limbs[4] = {};
+        std::size_t n = 0;
+        for (std::uint64_t part : {low, high}) {
+            for (int bits = 0; bits < 64; bits += LIMB_BITS) {
+                limbs[n++] = static_cast<limb_type>(part >> (bits % 64));
+            }
+        }
+        assignLimbs(negative, limbs, n);
+    }
+
+    // Keeps the invariant that every value fitting in int64_t is stored inline, so the
+    // operators' inline fast paths see every small value.
+    FRACLIB_INLINE void BigInt::assignLimbs(bool negative, const limb_type* limbs, std::size_t size) {
+        size = detail::trimmedSize(limbs, size);
+        if (size * LIMB_BITS <= 64) {
+            std::uint64_t mag = detail::bitsAt(limbs, size, 0);
+            if (mag <= static_cast<std::uint64_t>(INT64_MAX) || (negative && mag == static_cast<std::uint64_t>(INT64_MAX) + 1)) {
+                release();
+                small_ = negative ? static_cast<std::int64_t>(0 - mag) : static_cast<std::int64_t>(mag);
+                return;
+            }
+        }
+        if (limbs_ == nullptr || capacity_ < size) {
+            limb_type* storage = new limb_type[size];
+            std::memcpy(storage, limbs, size * sizeof(limb_type));
+            release();
+            limbs_ = storage;
+            capacity_ = static_cast<std::uint32_t>(size);
+        } else {
+            std::memmove(limbs_, limbs, size * sizeof(limb_type));
+        }
+        small_ = 0;
+        size_ = negative ? -static_cast<std::int32_t>(size) : static_cast<std::int32_t>(size);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Arithmetic
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE BigInt BigInt::addLarge(const BigInt& a, const BigInt& b, bool subtract) {
+        limb_type sa[2], sb[2];
+        LimbView x = a.view(sa), y = b.view(sb);
+        bool xNegative = a.isNegative();
+        bool yNegative = b.isNegative() != subtract;
+
+        detail::Limbs result;
+        bool negative = xNegative;
+        if (xNegative == yNegative) {
+            if (x.size < y.size) std::swap(x, y);
+            result.assign(x.data, x.data + x.size);
+            result.push_back(detail::addInto(result.data(), x.size, y.data, y.size));
+        } else {
+            // Signs differ: subtract the smaller magnitude from the larger
+            if (detail::compareLimbs(x.data, x.size, y.data, y.size) < 0) {
+                std::swap(x, y);
+                negative = yNegative;
+            }
+            result.assign(x.data, x.data + x.size);
+            detail::subtractFrom(result.data(), result.size(), y.data, y.size);
+        }
+        BigInt sum;
+        sum.assignLimbs(negative, result.data(), result.size());
+        return sum;
+    }
+
+    FRACLIB_INLINE BigInt BigInt::multiplyLarge(const BigInt& a, const BigInt& b) {
+        limb_type sa[2], sb[2];
+        LimbView x = a.view(sa), y = b.view(sb);
+        if (x.size == 0 || y.size == 0) return BigInt();
+        detail::Limbs result(x.size + y.size);
+        detail::multiplyLimbs(x.data, x.size, y.data, y.size, result.data());
+        BigInt product;
+        product.assignLimbs(a.isNegative() != b.isNegative(), result.data(), result.size());
+        return product;
+    }
+
+    FRACLIB_INLINE BigInt BigInt::divideLarge(const BigInt& a, const BigInt& b, bool remainder) {
+        if (b.isZero()) {
+            detail::throwError(std::invalid_argument(ZERO_DIVISOR_ERROR));
+        }
+        limb_type sa[2], sb[2];
+        LimbView x = a.view(sa), y = b.view(sb);
+        detail::Limbs q, r;
+        detail::divideMagnitudes(x.data, x.size, y.data, y.size, q, r);
+        BigInt result;
+        // Truncating division: the quotient's sign is the product of the signs, the
+        // remainder takes the dividend's sign
+        if (remainder) {
+            result.assignLimbs(a.isNegative(), r.data(), r.size());
+        } else {
+            result.assignLimbs(a.isNegative() != b.isNegative(), q.data(), q.size());
+        }
+        return result;
+    }
+
+    FRACLIB_INLINE int BigInt::compareLarge(const BigInt& a, const BigInt& b) noexcept {
+        bool aNegative = a.isNegative(), bNegative = b.isNegative();
+        if (aNegative != bNegative) return aNegative ? -1 : 1;
+        limb_type sa[2], sb[2];
+        LimbView x = a.view(sa), y = b.view(sb);
+        int magnitudeOrder = detail::compareLimbs(x.data, x.size, y.data, y.size);
+        return aNegative ? -magnitudeOrder : magnitudeOrder;
+    }
+
+    FRACLIB_INLINE BigInt BigInt::operator-() const {
+        if (isSmall() && small_ != INT64_MIN) return BigInt(-small_);
+        limb_type scratch[2];
+        LimbView x = view(scratch);
+        BigInt result;
+        result.assignLimbs(!isNegative() && x.size != 0, x.data, x.size);
+        return result;
+    }
+
+    FRACLIB_INLINE BigInt operator<<(const BigInt& a, std::size_t shift) {
+        BigInt::limb_type scratch[2];
+        BigInt::LimbView x = a.view(scratch);
+        if (x.size == 0) return BigInt();
+        std::size_t limbShift = shift / BigInt::LIMB_BITS;
+        int bitShift = static_cast<int>(shift % BigInt::LIMB_BITS);
+        detail::Limbs result(x.size + limbShift + 1, 0);
+        for (std::size_t i = 0; i < x.size; ++i) {
+            result[i + limbShift] |= static_cast<BigInt::limb_type>(x.data[i] << bitShift);
+            if (bitShift != 0) result[i + limbShift + 1] = static_cast<BigInt::limb_type>(x.data[i] >> (BigInt::LIMB_BITS - bitShift));
+        }
+        BigInt shifted;
+        shifted.assignLimbs(a.isNegative(), result.data(), result.size());
+        return shifted;
+    }
+
+    FRACLIB_INLINE BigInt operator>>(const BigInt& a, std::size_t shift) {
+        if (a.isNegative()) {
+            // floor(a / 2^s) = -(((|a| - 1) >> s) + 1)
+            return -(((-a) - 1) >> shift) - 1;
+        }
+        BigInt::limb_type scratch[2];
+        BigInt::LimbView x = a.view(scratch);
+        std::size_t limbShift = shift / BigInt::LIMB_BITS;
+        if (limbShift >= x.size) return BigInt();
+        int bitShift = static_cast<int>(shift % BigInt::LIMB_BITS);
+        detail::Limbs result(x.size - limbShift);
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = static_cast<BigInt::limb_type>(x.data[i + limbShift] >> bitShift);
+            if (bitShift != 0 && i + limbShift + 1 < x.size) {
+                result[i] |= static_cast<BigInt::limb_type>(x.data[i + limbShift + 1] << (BigInt::LIMB_BITS - bitShift));
+            }
+        }
+        BigInt shifted;
+        shifted.assignLimbs(false, result.data(), result.size());
+        return shifted;
+    }
+
+    FRACLIB_INLINE BigInt gcd(const BigInt& a, const BigInt& b) {
+        if (a.isSmall() && b.isSmall()) {
+            return BigInt(detail::gcdMagnitude(detail::magnitude(a.small_), detail::magnitude(b.small_)));
+        }
+        BigInt::limb_type sa[2], sb[2];
+        BigInt::LimbView x = a.view(sa), y = b.view(sb);
+        if (x.size == 0) return -b < b ? b : -b;
+        if (y.size == 0) return -a < a ? a : -a;
+        detail::Limbs result = detail::lehmerGcd(detail::Limbs(x.data, x.data + x.size), detail::Limbs(y.data, y.data + y.size));
+        BigInt g;
+        g.assignLimbs(false, result.data(), result.size());
+        return g;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Conversions
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE std::size_t BigInt::bitWidth() const noexcept {
+        limb_type scratch[2];
+        LimbView x = view(scratch);
+        return detail::bitWidthOf(x.data, x.size);
+    }
+
+    FRACLIB_INLINE BigInt::operator double() const noexcept {
+        if (isSmall()) return static_cast<double>(small_);
+        std::size_t width = bitWidth();
+        std::uint64_t top = detail::bitsAt(limbs_, limbCount(), width - 64);
+        double value = std::ldexp(static_cast<double>(top), static_cast<int>(width - 64));
+        return isNegative() ? -value : value;
+    }
+
+    FRACLIB_INLINE double ratioToDouble(const BigInt& n, const BigInt& d) noexcept {
+        if (n.isSmall() && d.isSmall()) {
+            return static_cast<double>(n.small_) / static_cast<double>(d.small_);
+        }
+        // Divide the leading 64 bits of each and scale by the difference in width
+        BigInt::limb_type sn[2], sd[2];
+        BigInt::LimbView x = n.view(sn), y = d.view(sd);
+        std::size_t nw = detail::bitWidthOf(x.data, x.size), dw = detail::bitWidthOf(y.data, y.size);
+        std::size_t nShift = nw > 64 ? nw - 64 : 0, dShift = dw > 64 ? dw - 64 : 0;
+        double ratio = static_cast<double>(detail::bitsAt(x.data, x.size, nShift)) /
+                       static_cast<double>(detail::bitsAt(y.data, y.size, dShift));
+        ratio = std::ldexp(ratio, static_cast<int>(nShift) - static_cast<int>(dShift));
+        return n.isNegative() != d.isNegative() ? -ratio : ratio;
+    }
+
+    FRACLIB_INLINE std::string BigInt::toString() const {
+        if (isSmall()) return detail::integerToString(small_);
+        // Peel off 9 decimal digits per division
+        detail::Limbs limbs(limbs_, limbs_ + limbCount());
+        std::vector<std::uint32_t> chunks;
+        std::size_t n = limbs.size();
+        while (n != 0) {
+            chunks.push_back(static_cast<std::uint32_t>(detail::divideBySingle(limbs.data(), n, 1000000000u)));
+            n = detail::trimmedSize(limbs.data(), n);
+        }
+        std::string text = isNegative() ? "-" : "";
+        text += std::to_string(chunks.back());
+        for (std::size_t i = chunks.size() - 1; i-- > 0;) {
+            std::string part = std::to_string(chunks[i]);
+            text.append(9 - part.size(), '0');
+            text += part;
+        }
+        return text;
+    }
+
+    FRACLIB_INLINE std::ostream& operator<<(std::ostream& os, const BigInt& value) {
+        return os << value.toString();
+    }
+}
@@ -28,201 +28,614 @@
 /**************************************************************************/
 
 #pragma once
+#include <functional>
 #include <string>
 #include <stdexcept>
+#include <iosfwd>
+#include "fraction_traits.h"
+#include "fraction_policy.h"
+#include "fraction_parse.h"
+#include "fraction_result.h"
+#include "fraction_format.h"
+#include "fraction_stats.h"
 
 namespace FracLib {
-    class Fraction {
+    /// @brief How a `double` becomes a fraction.
+    enum class DoubleConversion : std::uint8_t {
+        /// The exact binary value: mantissa over a power of two (0.1 is 3602879701896397/2^55).
+        /// When that does not fit in the storage type, the closest fraction that does (0.1 is
+        /// 1/10 in 32 bits), which near the ends of the range is the nearest integer. Throws
+        /// std::overflow_error only if the magnitude is out of range.
+        Exact,
+        /// The value rounded to six decimal places, then reduced (0.1 is 1/10).
+        Decimal
+    };
+
+    template <typename FractionT, typename Node> class FractionExpression;
+
+    /// @brief A fraction stored as two integers of type `IntT`. Intermediate results are
+    /// computed in `FractionTraits<IntT>::wide_type` and range-checked once when narrowed back.
+    /// Arithmetic, comparison and simplification are constexpr and defined inline; overflow
+    /// or division by zero during constant evaluation is a compile error.
+    /// @tparam IntT signed integer storage type, see the `Fraction*` aliases below.
+    /// @tparam OverflowPolicy what happens when a result does not fit: ThrowOnOverflow (default),
+    /// SaturateOnOverflow, UncheckedOverflow or PromoteOnOverflow, optionally wrapped in
+    /// Normalized or Lazy (see fraction_policy.h).
+    template <typename IntT, typename OverflowPolicy = ThrowOnOverflow>
+    class BasicFraction : private detail::ReducedFlag<detail::PolicyIsLazy<OverflowPolicy>::value> {
+        template <typename, typename> friend class BasicFraction;
+        template <typename, typename> friend class FractionExpression;
     public:
-        static const char* ZERO_DIVISOR_ERROR;
-        static const char* OVERFLOW_ERROR;
-        static const char* INVALID_STRING_PARAMETER_ERROR;
+        using value_type = IntT;
+        using traits_type = FractionTraits<IntT>;
+        using wide_type = typename traits_type::wide_type;
+        using policy_type = OverflowPolicy;
+        /// @brief Type returned by the arithmetic operators. Same as this type unless the
+        /// policy promotes results to a wider type.
+        using result_type = BasicFraction<typename OverflowPolicy::template promoted_type<IntT>, OverflowPolicy>;
+        /// @brief True when the policy keeps values in canonical form (see Normalized).
+        static constexpr bool is_normalized = detail::PolicyNormalizes<OverflowPolicy>::value;
+        /// @brief True when the policy defers reduction (see Lazy).
+        static constexpr bool is_lazy = detail::PolicyIsLazy<OverflowPolicy>::value;
+        static_assert(!(is_normalized && is_lazy), "A fraction cannot be both normalized and lazy.");
+
+        static constexpr const char* ZERO_DIVISOR_ERROR = "Division by zero not allowed. Denominator cannot be zero.";
+        static constexpr const char* OVERFLOW_ERROR = detail::overflowErrorMessage;
+        static constexpr const char* INVALID_STRING_PARAMETER_ERROR = "Improper format. Accepted fraction form: (ie \"1/2\" or \"25\" or  \"3 1/2\").";
+        static constexpr const char* NON_FINITE_ERROR = "Cannot convert NaN or infinity to a fraction.";
+        static constexpr const char* MAX_DENOMINATOR_ERROR = "The denominator bound must be at least 1.";
     public:
-        int numerator;
-        int denominator;
+        IntT numerator;
+        IntT denominator;
 
     public: // CONSTRUCTORS
         /// @brief Default constructor. Initializes the fraction to `0/1`.
         /// @example Fraction f; // Represents 0/1
-        Fraction();
+        constexpr BasicFraction();
         /// @brief Constructs a Fraction object with the given integer numerator.
         /// @param n The integer numerator (denominator is set to 1).
-        /// @param simplify Determines whether the fraction will attempt to simplify or not.
+        /// @throws std::overflow_error If `n` does not fit in `IntT`.
         /// @example Fraction f(5); // Creates a fraction representing 5/1
-        Fraction(int n);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr BasicFraction(I n);
         /// @brief Constructs a Fraction object with the specified numerator and denominator.
         /// @param n The numerator.
         /// @param d The denominator.
         /// @param simplify Determines whether the fraction will attempt to simplify or not.
+        /// Normalized fractions always simplify.
         /// @throws std::invalid_argument If the denominator is zero.
+        /// @throws std::overflow_error If the simplified fraction does not fit, e.g. `(INT_MIN, -1)`.
         /// @example Fraction f(3, 4); // Creates a fraction representing 3/4
-        Fraction(int n, int d, bool simplify = false);
-        /// @brief Constructs a Fraction object from a decimal number by approximating its fractional equivalent.
-        /// The fraction is then simplified.
-        /// @param decimal The decimal number to convert to a fraction.
+        constexpr BasicFraction(IntT n, IntT d, bool simplify = false);
+        /// @brief Constructs a Fraction object from a double. The result is in lowest terms.
+        /// @param decimal The number to convert to a fraction.
+        /// @param mode `Exact` (default) keeps the double's exact binary value, or the closest
+        /// fraction that fits; `Decimal` rounds it to six decimal places first.
+        /// @throws std::overflow_error If the magnitude is out of `IntT`'s range.
+        /// @throws std::invalid_argument If `decimal` is NaN or infinite.
         /// @example Fraction f(0.75); // Creates a fraction representing 3/4
-        Fraction(double decimal);
-        /// @brief Constructs a Fraction object by parsing a string representation.
+        BasicFraction(double decimal, DoubleConversion mode = DoubleConversion::Exact);
+        /// @brief Constructs a Fraction object by parsing a string representation. Characters
+        /// after a complete fraction are ignored ("3/4;" is 3/4), but a whole number may only be
+        /// followed by blanks ("3 1" is rejected). The `std::string_view` overload rejects both.
         /// @param fracStr The string representing the fraction, in the format "numerator/denominator", "numerator" or "whole numerator/denominator".
         /// @param simplify Determines whether the fraction will attempt to simplify or not.
         /// @throws std::invalid_argument If the string is not properly formatted or if the denominator is zero.
         /// @example Fraction f("3/4"); // Creates a fraction representing 3/4
-        Fraction(const char* fracStr, bool simplify = false);
-        /// @brief Copy constructor. Creates a new Fraction object as a copy of an existing Fraction.
-        /// @param other The Fraction object to copy.
-        /// @example Fraction f2(f1); // f2 is a copy of f1
-        Fraction(Fraction& other);
+        constexpr BasicFraction(const char* fracStr, bool simplify = false);
+        /// @brief Constructs a Fraction object by parsing a string representation, see `parse`.
+        /// Blanks around the fraction are allowed, anything else is not.
+        /// @throws std::invalid_argument If the string is not properly formatted or if the denominator is zero.
+        /// @throws std::overflow_error If a component does not fit in `IntT`.
+        /// @example Fraction f(std::string_view("-1 1/2")); // Creates a fraction representing -3/2
+        constexpr explicit BasicFraction(std::string_view fracStr, bool simplify = false);
+        /// @brief Converts from a fraction with a narrower (or equal) storage type or another policy.
+        /// @example Fraction64 f = Fraction32(1, 3);
+        template <typename OtherInt, typename OtherPolicy, std::enable_if_t<detail::IsWideningConversion<OtherInt, IntT>::value, int> = 0>
+        constexpr BasicFraction(const BasicFraction<OtherInt, OtherPolicy>& other);
+        /// @brief Converts from a fraction with a wider storage type. Components that do not fit
+        /// are handled by this type's OverflowPolicy.
+        /// @example Fraction32 f(Fraction64(1, 3));
+        template <typename OtherInt, typename OtherPolicy, std::enable_if_t<!detail::IsWideningConversion<OtherInt, IntT>::value, int> = 0>
+        constexpr explicit BasicFraction(const BasicFraction<OtherInt, OtherPolicy>& other);
+        // Copy construction and assignment are implicit (trivial), see the static_asserts below.
 
     public: // OPERATORS
         
         // Basic Arithmetic
-        Fraction operator+(const Fraction& other);
-        Fraction operator+(int value);
-        Fraction operator+(double value);
-        Fraction operator+(const char* value);
-
-        Fraction operator-(const Fraction& other);
-        Fraction operator-(int value);
-        Fraction operator-(double value);
-        Fraction operator-(const char* value);
-
-        Fraction operator*(const Fraction& other);
-        Fraction operator*(int value);
-        Fraction operator*(double value);
-        Fraction operator*(const char* value);
-
-        Fraction operator/(const Fraction& other);
-        Fraction operator/(int value);
-        Fraction operator/(double value);
-        Fraction operator/(const char* value);
+        constexpr result_type operator+(const BasicFraction& other) const;
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr result_type operator+(I value) const;
+        result_type operator+(double value) const;
+        result_type operator+(const char* value) const;
+
+        constexpr result_type operator-(const BasicFraction& other) const;
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr result_type operator-(I value) const;
+        result_type operator-(double value) const;
+        result_type operator-(const char* value) const;
+
+        constexpr result_type operator*(const BasicFraction& other) const;
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr result_type operator*(I value) const;
+        result_type operator*(double value) const;
+        result_type operator*(const char* value) const;
+
+        constexpr result_type operator/(const BasicFraction& other) const;
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr result_type operator/(I value) const;
+        result_type operator/(double value) const;
+        result_type operator/(const char* value) const;
         
         // Reversed order - ie 2 + Fraction
-        friend Fraction operator+(int value, const Fraction& frac);
-        friend Fraction operator+(double value, Fraction& frac);
-        friend Fraction operator+(const char* value, Fraction& frac);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        friend constexpr result_type operator+(I value, const BasicFraction& frac) { return unwrap(tryAdd(value, frac)); }
+        friend result_type operator+(double value, const BasicFraction& frac) { return BasicFraction(value) + frac; }
+        friend result_type operator+(const char* value, const BasicFraction& frac) { return BasicFraction(value) + frac; }
 
-        friend Fraction operator-(int value, const Fraction& frac);
-        friend Fraction operator-(double value, Fraction& frac);
-        friend Fraction operator-(const char* value, Fraction& frac);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        friend constexpr result_type operator-(I value, const BasicFraction& frac) { return unwrap(trySubtract(value, frac)); }
+        friend result_type operator-(double value, const BasicFraction& frac) { return BasicFraction(value) - frac; }
+        friend result_type operator-(const char* value, const BasicFraction& frac) { return BasicFraction(value) - frac; }
 
-        friend Fraction operator*(int value, const Fraction& frac);
-        friend Fraction operator*(double value, Fraction& frac);
-        friend Fraction operator*(const char* value, Fraction& frac);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        friend constexpr result_type operator*(I value, const BasicFraction& frac) { return unwrap(tryMultiply(value, frac)); }
+        friend result_type operator*(double value, const BasicFraction& frac) { return BasicFraction(value) * frac; }
+        friend result_type operator*(const char* value, const BasicFraction& frac) { return BasicFraction(value) * frac; }
 
-        friend Fraction operator/(int value, const Fraction& frac);
-        friend Fraction operator/(double value, Fraction& frac);
-        friend Fraction operator/(const char* value, Fraction& frac);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        friend constexpr result_type operator/(I value, const BasicFraction& frac) { return unwrap(tryDivide(value, frac)); }
+        friend result_type operator/(double value, const BasicFraction& frac) { return BasicFraction(value) / frac; }
+        friend result_type operator/(const char* value, const BasicFraction& frac) { return BasicFraction(value) / frac; }
         
         // Compound
-        void operator+=(const Fraction& other);
-        void operator+=(int value);
+        constexpr void operator+=(const BasicFraction& other);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr void operator+=(I value);
         void operator+=(double value);
         void operator+=(const char* value);
 
-        void operator-=(const Fraction& other);
-        void operator-=(int value);
+        constexpr void operator-=(const BasicFraction& other);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr void operator-=(I value);
         void operator-=(double value);
         void operator-=(const char* value);
 
-        void operator*=(const Fraction& other);
-        void operator*=(int value);
+        constexpr void operator*=(const BasicFraction& other);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr void operator*=(I value);
         void operator*=(double value);
         void operator*=(const char* value);
 
-        void operator/=(const Fraction& other);
-        void operator/=(int value);
+        constexpr void operator/=(const BasicFraction& other);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        constexpr void operator/=(I value);
         void operator/=(double value);
         void operator/=(const char* value);
         
         // Increment/Decrement Post/Pre
-        Fraction& operator++();
-        Fraction& operator--();
-        Fraction operator++(int);
-        Fraction operator--(int);
+        constexpr BasicFraction& operator++();
+        constexpr BasicFraction& operator--();
+        constexpr BasicFraction operator++(int);
+        constexpr BasicFraction operator--(int);
 
         // Unary
-        Fraction operator-();
+        constexpr BasicFraction operator-() const;
 
         // Comparision
-        bool operator==(const Fraction& other) const;
+        constexpr bool operator==(const BasicFraction& other) const;
         bool operator==(double other) const;
         bool operator==(const char* other) const;
-        friend bool operator==(double other, Fraction& frac);
-        friend bool operator==(const char* other, Fraction& frac);
+        friend bool operator==(double other, const BasicFraction& frac) { return frac == other; }
+        friend bool operator==(const char* other, const BasicFraction& frac) { return (BasicFraction(other) == frac); }
 
-        bool operator!=(const Fraction& other) const;
+        constexpr bool operator!=(const BasicFraction& other) const;
         bool operator!=(double other) const;
         bool operator!=(const char* other) const;
-        friend bool operator!=(double other, Fraction& frac);
-        friend bool operator!=(const char* other, Fraction& frac);
+        friend bool operator!=(double other, const BasicFraction& frac) { return frac != other; }
+        friend bool operator!=(const char* other, const BasicFraction& frac) { return (BasicFraction(other) != frac); }
 
-        bool operator>=(const Fraction& other) const;
+        constexpr bool operator>=(const BasicFraction& other) const;
         bool operator>=(double other) const;
         bool operator>=(const char* other) const;
-        friend bool operator>=(double other, Fraction& frac);
-        friend bool operator>=(const char* other, Fraction& frac);
+        friend bool operator>=(double other, const BasicFraction& frac) { return frac <= other; }
+        friend bool operator>=(const char* other, const BasicFraction& frac) { return (BasicFraction(other) >= frac); }
 
-        bool operator<=(const Fraction& other) const;
+        constexpr bool operator<=(const BasicFraction& other) const;
         bool operator<=(double other) const;
         bool operator<=(const char* other) const;
-        friend bool operator<=(double other, Fraction& frac);
-        friend bool operator<=(const char* other, Fraction& frac);
+        friend bool operator<=(double other, const BasicFraction& frac) { return frac >= other; }
+        friend bool operator<=(const char* other, const BasicFraction& frac) { return (BasicFraction(other) <= frac); }
 
-        bool operator>(const Fraction& other) const;
+        constexpr bool operator>(const BasicFraction& other) const;
         bool operator>(double other) const;
         bool operator>(const char* other) const;
-        friend bool operator>(double other, Fraction& frac);
-        friend bool operator>(const char* other, Fraction& frac);
+        friend bool operator>(double other, const BasicFraction& frac) { return frac < other; }
+        friend bool operator>(const char* other, const BasicFraction& frac) { return (BasicFraction(other) > frac); }
 
-        bool operator<(const Fraction& other) const;
+        constexpr bool operator<(const BasicFraction& other) const;
         bool operator<(double other) const;
         bool operator<(const char* other) const;
-        friend bool operator<(double other, Fraction& frac);
-        friend bool operator<(const char* other, Fraction& frac);
+        friend bool operator<(double other, const BasicFraction& frac) { return frac > other; }
+        friend bool operator<(const char* other, const BasicFraction& frac) { return (BasicFraction(other) < frac); }
 
         // Assignment
-        Fraction& operator=(const Fraction& other);
-        Fraction& operator=(const char* str);
-        Fraction& operator=(double decimal);
+        BasicFraction& operator=(const char* str);
+        BasicFraction& operator=(double decimal);
 
         // Insertion/Extraction
-        friend std::ostream& operator<<(std::ostream& os, const Fraction& frac);
-        friend std::istream& operator>>(std::istream& is, Fraction& frac);
+        friend std::ostream& operator<<(std::ostream& os, const BasicFraction& frac) { return frac.write(os); }
+        friend std::istream& operator>>(std::istream& is, BasicFraction& frac) { return frac.read(is); }
+
+    public: // METHODS
+
+        /// @brief Whether this fraction is known to be in lowest terms with a positive
+        /// denominator, without computing a GCD: always for Normalized fractions, when the
+        /// last result was reduced (or is an integer) for Lazy ones, never otherwise.
+        constexpr bool knownReduced() const noexcept;
 
     public: // STATIC METHODS
         
+        /// @brief Parses "n", "n/d" or "w n/d" (optionally preceded by blanks and a '-') from the
+        /// start of `text` without allocating. Parsing stops at the first character that cannot
+        /// continue the fraction, so the rest of `text` can be scanned from `result.consumed`.
+        /// @param text Characters to parse.
+        /// @param out Receives the fraction; left unchanged on error.
+        /// @param simplify Determines whether the fraction will attempt to simplify or not.
+        /// @return The error, if any, and the number of characters consumed.
+        /// @example Fraction f; auto r = Fraction::parse("3/4, 1/2", f); // f = 3/4, r.consumed = 3
+        static constexpr ParseResult parse(std::string_view text, BasicFraction& out, bool simplify = false) noexcept(traits_type::is_bounded);
+        /// @brief Exact three-way comparison: -1, 0 or 1 as `a` is less than, equal to or greater
+        /// than `b`. Never overflows and does not need reduced operands or positive denominators.
+        /// Built-in types with a wider type compare one exact cross product. The widest type and
+        /// `BigFraction` decide signs and equal denominators without multiplying. `BigFraction`
+        /// then compares the `toDouble` values against a rigorous error bound and only
+        /// cross-multiplies when they are too close to call. The widest type cross-multiplies
+        /// when the products fit; otherwise it tries the doubles the same way and then compares
+        /// continued fractions. See `compareStats()`.
+        /// @example Fraction::compare(Fraction(1, 3), Fraction(2, 5)); // -1
+        static constexpr int compare(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded);
         /// @brief Best use is for inline math operations. Simplifies a Fraction object using GCD(Greatest Common Divisor).
         /// @param frac Fraction value object.
-        static Fraction Simplify(Fraction frac);
+        static constexpr BasicFraction Simplify(BasicFraction frac);
         /// @brief Best use is for straight-forward simplification. Simplifies a Fraction object using GCD(Greatest Common Divisor).
         /// @param frac Fraction reference object.
-        static void SimplifyFraction(Fraction& frac);
+        static constexpr void SimplifyFraction(BasicFraction& frac);
+        /// @brief `frac` in lowest terms with a positive denominator, the form printed and hashed.
+        /// Unlike Simplify it never throws: a value with no such form in `IntT`, like
+        /// `(min, -1)`, is returned unchanged. Free when `frac.knownReduced()`.
+        static constexpr BasicFraction Canonical(const BasicFraction& frac) noexcept(traits_type::is_bounded);
         /// @brief Converts a Fraction object to a string (ie. "1/2").
         /// @param frac Fraction object
         /// @return fraction as string
-        static std::string toString(const Fraction& frac);
-        static float toFloat(const Fraction& frac);
+        static std::string toString(const BasicFraction& frac);
+        static constexpr float toFloat(const BasicFraction& frac);
         /// @brief Converts a fraction to a floating decimal.
         /// @param frac Fraction object.
         /// @return fraction as float.
-        static double toDouble(const Fraction& frac);
+        static constexpr double toDouble(const BasicFraction& frac);
+        /// @brief Converts `count` doubles into `out`, see the double constructor.
+        /// @throws std::overflow_error or std::invalid_argument At the first value that cannot be
+        /// converted; the values before it have been written.
+        static void fromDoubles(const double* values, std::size_t count, BasicFraction* out, DoubleConversion mode = DoubleConversion::Exact);
+        /// @brief Closest fraction to `value` with a denominator of at most `maxDenominator`, in
+        /// lowest terms. Walks the continued fraction of `value` (the Stern-Brocot descent) and
+        /// picks the last convergent or the best semiconvergent within the bound, so the cost
+        /// grows with the number of partial quotients, not with `maxDenominator`.
+        /// A value whose denominator is already within the bound is returned in lowest terms.
+        /// @throws std::invalid_argument If `maxDenominator` is less than 1.
+        /// @example Fraction::limitDenominator(Fraction(333333, 1000000), 10); // 1/3
+        static constexpr BasicFraction limitDenominator(const BasicFraction& value, IntT maxDenominator);
+        /// @brief limitDenominator applied to the exact value of a double.
+        /// @throws std::invalid_argument If `value` is NaN or infinite, or `maxDenominator` is less than 1.
+        /// @throws std::overflow_error If the result does not fit in `IntT`.
+        /// @example Fraction::limitDenominator(3.141592653589793, 1000); // 355/113
+        static BasicFraction limitDenominator(double value, IntT maxDenominator);
+        /// @brief limitDenominator for `count` doubles into `out`.
+        /// @throws See limitDenominator, at the first value that fails; the values before it have been written.
+        static void limitDenominators(const double* values, std::size_t count, IntT maxDenominator, BasicFraction* out);
         /// @brief Returns the reciprocal of a fraction as a new Fraction object.
         /// @param frac fraction to get reciprocal of
         /// @return fraction reciprocal
-        static Fraction toReciprocal(const Fraction& frac);
+        static constexpr BasicFraction toReciprocal(const BasicFraction& frac);
+
+    public: // STATUS API
+        // Exception-free counterparts of the operators, for hot loops and builds without
+        // exceptions: a zero divisor, an overflow the policy raises (see `raises` in
+        // fraction_policy.h) or malformed text comes back as a FractionError. The operators are
+        // thin wrappers that throw the error, so both give identical results.
+
+        /// @brief `a + b`, or the error the operator would throw.
+        /// @example auto r = Fraction64::tryAdd(a, b); if (r) sum = *r;
+        static constexpr FractionResult<result_type> tryAdd(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> tryAdd(const BasicFraction& a, I b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> tryAdd(I a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        /// @brief `a - b`, or the error the operator would throw.
+        static constexpr FractionResult<result_type> trySubtract(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> trySubtract(const BasicFraction& a, I b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> trySubtract(I a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        /// @brief `a * b`, or the error the operator would throw.
+        static constexpr FractionResult<result_type> tryMultiply(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> tryMultiply(const BasicFraction& a, I b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> tryMultiply(I a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        /// @brief `a / b`, or the error the operator would throw: `ZeroDivisor` when `b` is zero.
+        /// @example auto r = Fraction64::tryDivide(a, b); // r.error() == FractionError::ZeroDivisor if b == 0
+        static constexpr FractionResult<result_type> tryDivide(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> tryDivide(const BasicFraction& a, I b) noexcept(traits_type::is_bounded);
+        template <typename I, detail::EnableIfInteger<I> = 0>
+        static constexpr FractionResult<result_type> tryDivide(I a, const BasicFraction& b) noexcept(traits_type::is_bounded);
+        /// @brief `BasicFraction(n, d, simplify)`, or `ZeroDivisor` when `d` is zero and
+        /// `Overflow` when the simplified fraction does not fit, e.g. `(INT_MIN, -1)`.
+        static constexpr FractionResult<BasicFraction> tryMake(IntT n, IntT d, bool simplify = false) noexcept(traits_type::is_bounded);
+        /// @brief The string constructor without exceptions: the whole of `text`, apart from
+        /// surrounding blanks, must be one fraction. See `parse` to scan a fraction off the
+        /// front of a longer text.
+        /// @example Fraction64::tryParse("3/0").error(); // FractionError::ZeroDivisor
+        static constexpr FractionResult<BasicFraction> tryParse(std::string_view text, bool simplify = false) noexcept(traits_type::is_bounded);
+        /// @brief toReciprocal, or `ZeroDivisor` for a zero fraction.
+        static constexpr FractionResult<BasicFraction> tryReciprocal(const BasicFraction& frac) noexcept(traits_type::is_bounded);
 
     private: // PRIVATE FUNCTIONS
-        void simplify();
+        constexpr void simplify();
+        /// @brief Lazy results only: reduces when a component is wider than the policy's
+        /// threshold, otherwise leaves the value as computed. No-op for other fractions.
+        constexpr void settle() noexcept(traits_type::is_bounded);
 
-        /// @brief Parses input stream fractions to Fraction members numerator and denominator.
-        /// @param is input stream.
+        /// @brief `parse` with the rules the `const char*` entry points and `operator>>` have
+        /// always had: text after "n/d" or "w n/d" is ignored ("3/4abc" is 3/4), but a whole
+        /// number may only be followed by blanks, so a truncated mixed number ("3 1", "3 1/") is
+        /// rejected instead of read as 3.
+        static constexpr ParseResult parseLeading(std::string_view text, BasicFraction& out, bool simplify = false) noexcept(traits_type::is_bounded);
+        /// @brief Parses a string into this fraction.
+        /// @param text string to parse.
         /// @param simplify optional, simplify fraction.
-        void parseFromStream(std::istream& is, bool simplify = false);
-        /// @brief Converts a decimal into a Fraction by assigning the numerator and denominator
+        /// @throws std::invalid_argument or std::overflow_error, see `parse` for the accepted forms.
+        void assignString(std::string_view text, bool simplify = false);
+        /// @brief Converts a double into a Fraction by assigning the numerator and denominator
         /// to this Fraction object. The Fraction is simplified.
-        /// @param decimal decimal to convert to fraction.
-        void toFraction(double decimal);
+        /// @param decimal double to convert to fraction.
+        /// @param mode exact binary value or rounded to six decimal places.
+        void toFraction(double decimal, DoubleConversion mode = DoubleConversion::Exact);
+        /// @brief The exact value `m * 2^e` with odd `m`, so the only reduction needed is the
+        /// one done by shifting out the mantissa's trailing zeros.
+        void toExactFraction(double value);
+        void toDecimalFraction(double decimal);
+        /// @brief Orders `frac` against `value` (not NaN) converted as by the double constructor.
+        /// Doubles out of `IntT`'s range order by sign instead of throwing.
+        static int compareToDouble(const BasicFraction& frac, double value);
+
+        std::ostream& write(std::ostream& os) const;
+        std::istream& read(std::istream& is);
+
+        /// @brief Narrows a wide intermediate back to `IntT`.
+        /// @throws std::overflow_error If the value does not fit.
+        static constexpr IntT narrow(wide_type value);
+        /// @brief Converts any integer operand to `IntT`.
+        /// @throws std::overflow_error If the value does not fit.
+        template <typename I>
+        static constexpr IntT checkedValue(I value);
+        /// @brief Exact product of two components in `wide_type`. Only the widest storage type
+        /// (which has no wider type to promote into) can overflow here.
+        static constexpr wide_type wideMul(wide_type a, wide_type b);
+        static constexpr wide_type wideAdd(wide_type a, wide_type b);
+        static constexpr wide_type wideSub(wide_type a, wide_type b);
+        /// @brief Builds a fraction from wide intermediates, range-checking both once.
+        static constexpr BasicFraction fromWide(wide_type n, wide_type d);
+        template <typename W>
+        static constexpr BasicFraction fromComponents(W n, W d);
+
+        /// @brief True when overflow is reported as FractionError::Overflow, see PolicyRaises.
+        static constexpr bool raises_errors = detail::PolicyRaises<OverflowPolicy>::value && OverflowPolicy::checked && traits_type::is_bounded;
+        /// @brief Throws the exception the throwing API uses for `error`; nothing for `None`.
+        static constexpr void raiseIfError(FractionError error);
+        [[noreturn]] static void raiseError(FractionError error);
+        /// @brief The value of `result`, or its error thrown.
+        template <typename T>
+        static constexpr T unwrap(const FractionResult<T>& result);
+        /// @brief Status-returning forms of the helpers above: a raising policy's overflow is
+        /// returned as an error (false for the scalar ones), other policies substitute as usual.
+        template <typename I>
+        static constexpr bool tryCheckedValue(I value, IntT& out) noexcept(traits_type::is_bounded);
+        static constexpr bool tryWideMul(wide_type a, wide_type b, wide_type& out) noexcept(traits_type::is_bounded);
+        static constexpr bool tryWideAdd(wide_type a, wide_type b, wide_type& out) noexcept(traits_type::is_bounded);
+        static constexpr bool tryWideSub(wide_type a, wide_type b, wide_type& out) noexcept(traits_type::is_bounded);
+        template <typename W>
+        static constexpr FractionError tryFromComponents(W n, W d, BasicFraction& out) noexcept(traits_type::is_bounded);
+        /// @brief Result of a fraction whose components do not fit: the error for raising
+        /// policies, the policy's substitute otherwise.
+        template <typename W>
+        static constexpr FractionError narrowOverflow(W n, W d, BasicFraction& out) noexcept(traits_type::is_bounded);
+
+        /// @brief Builds `(negative ? -p : p) / q` from limitDenominator's magnitudes.
+        /// @throws std::overflow_error If `p` does not fit in `IntT`.
+        template <typename M>
+        static constexpr BasicFraction fromMagnitudes(bool negative, M p, M q);
+        /// @brief Stores n/d (n, d built-in, d nonzero) in lowest terms with a positive denominator.
+        /// @return false if the reduced fraction does not fit in `IntT`.
+        template <typename W>
+        static constexpr bool reduceInto(W n, W d, BasicFraction& out) noexcept;
+
+        /// @brief Shared body of tryAdd and trySubtract.
+        static constexpr FractionError tryAddFractions(const BasicFraction& x, const BasicFraction& y, bool subtract, result_type& out) noexcept(traits_type::is_bounded);
+        /// @brief Shared body of tryMultiply and tryDivide: (a/b) * (c/d).
+        static constexpr FractionError tryMultiplyFractions(IntT a, IntT b, IntT c, IntT d, result_type& out) noexcept(traits_type::is_bounded);
+        /// @brief True for the types whose operators cancel common factors before multiplying:
+        /// the widest built-in type, whose products can overflow with nothing wider to hold
+        /// them, and BigFraction, whose products only grow (unless it is lazy). Narrower types
+        /// compute exactly in `wide_type` and reduce only results that do not fit.
+        static constexpr bool cancels_first = traits_type::is_bounded ? !traits_type::has_wider : !is_lazy;
+        /// @brief a/b * c/d with gcd(a, d) and gcd(c, b) cancelled before multiplying.
+        /// @return false if the result still does not fit (built-in types only).
+        static constexpr bool multiplyCancelled(IntT a, IntT b, IntT c, IntT d, BasicFraction& out) noexcept(traits_type::is_bounded);
+        /// @brief a/b + c/d, or a/b - c/d when `subtract`, by Knuth's split on g = gcd(b, d):
+        /// t = a(d/g) +/- c(b/g) and the result is (t/h) / ((b/g)(d/h)) with h = gcd(t, g), which
+        /// is in lowest terms when the operands are.
+        /// @return false if an intermediate or the result does not fit (built-in types only).
+        static constexpr bool addSplit(IntT a, IntT b, IntT c, IntT d, bool subtract, BasicFraction& out) noexcept(traits_type::is_bounded);
+
+        /// @brief frac + value, or frac - value when `subtract`.
+        static constexpr FractionError tryAddInteger(const BasicFraction& frac, IntT value, bool subtract, result_type& out) noexcept(traits_type::is_bounded);
+        static constexpr FractionError trySubtractFromInteger(IntT value, const BasicFraction& frac, result_type& out) noexcept(traits_type::is_bounded);
+        static constexpr FractionError tryMultiplyInteger(const BasicFraction& frac, IntT value, result_type& out) noexcept(traits_type::is_bounded);
+        static constexpr FractionError tryDivideByInteger(const BasicFraction& frac, IntT value, result_type& out) noexcept(traits_type::is_bounded);
+        static constexpr FractionError tryDivideInteger(IntT value, const BasicFraction& frac, result_type& out) noexcept(traits_type::is_bounded);
     };
+
+    using Fraction16 = BasicFraction<std::int16_t>;
+    using Fraction32 = BasicFraction<std::int32_t>;
+    using Fraction64 = BasicFraction<std::int64_t>;
+#ifdef FRACLIB_HAS_INT128
+    using Fraction128 = BasicFraction<int128_t>;
+#endif
+    /// @brief The default fraction type (`int` components), kept for source compatibility.
+    using Fraction = BasicFraction<int>;
+    /// @brief A fraction that is always in lowest terms with a positive denominator.
+    /// @example NormalizedFraction<std::int64_t> f(6, -4); // -3/2
+    template <typename IntT, typename OverflowPolicy = ThrowOnOverflow>
+    using NormalizedFraction = BasicFraction<IntT, Normalized<OverflowPolicy>>;
+    /// @brief A fraction that reduces only when its components pass `ThresholdBits` bits.
+    /// @example LazyFraction<std::int64_t> f = LazyFraction<std::int64_t>(1, 2) * LazyFraction<std::int64_t>(2, 3); // 2/6, prints "1/3"
+    template <typename IntT, typename OverflowPolicy = ThrowOnOverflow, int ThresholdBits = 0>
+    using LazyFraction = BasicFraction<IntT, Lazy<OverflowPolicy, ThresholdBits>>;
+
+    /// @brief Formats `value` into `[first, last)`, like `std::to_chars`. Never allocates for
+    /// built-in widths; `maxFormattedChars<IntT>` characters are always enough.
+    /// @return `{end, std::errc()}`, or `{last, std::errc::value_too_large}` if the range is too
+    /// small (its contents are then unspecified).
+    /// @example char buf[32]; auto r = to_chars(buf, buf + 32, Fraction(-7, 2), FractionFormat::Mixed); // "-3 1/2"
+    template <typename IntT, typename OverflowPolicy>
+    std::to_chars_result to_chars(char* first, char* last, const BasicFraction<IntT, OverflowPolicy>& value,
+        FractionFormat format = FractionFormat::Improper) noexcept(FractionTraits<IntT>::is_bounded);
+    /// @brief Formats `count` fractions into one buffer, each followed by `separator`. Stops at
+    /// the first value that does not fit; `count` in the result says how many were written.
+    template <typename IntT, typename OverflowPolicy>
+    BatchFormatResult to_chars(char* first, char* last, const BasicFraction<IntT, OverflowPolicy>* values, std::size_t count,
+        FractionFormat format = FractionFormat::Improper, char separator = '\n') noexcept(FractionTraits<IntT>::is_bounded);
 }
 
+#include "fraction_impl.h"
+
+namespace FracLib {
+    // Fractions must stay plain pairs of integers so arrays of them can be memcpy'd and
+    // loops over them vectorized.
+    static_assert(std::is_trivially_copyable<Fraction16>::value, "Fraction16 must be trivially copyable.");
+    static_assert(std::is_trivially_copyable<Fraction32>::value, "Fraction32 must be trivially copyable.");
+    static_assert(std::is_trivially_copyable<Fraction64>::value, "Fraction64 must be trivially copyable.");
+#ifdef FRACLIB_HAS_INT128
+    static_assert(std::is_trivially_copyable<Fraction128>::value, "Fraction128 must be trivially copyable.");
+#endif
+
+    namespace detail {
+        /// @brief Reached when a fraction literal is not a fraction. Not constexpr, so the
+        /// literal does not compile; named so the diagnostic says why.
+        [[noreturn]] inline void malformedFractionLiteral(FractionError error) {
+            switch (error) {
+                case FractionError::ZeroDivisor:
+                    throwError(std::invalid_argument(Fraction::ZERO_DIVISOR_ERROR));
+                case FractionError::Overflow:
+                    throwError(std::overflow_error(Fraction::OVERFLOW_ERROR));
+                default:
+                    throwError(std::invalid_argument(Fraction::INVALID_STRING_PARAMETER_ERROR));
+            }
+        }
+
+        template <typename FractionT>
+        FRACLIB_CONSTEVAL FractionT fractionLiteral(const char* text, std::size_t size) {
+            FractionResult<FractionT> result = FractionT::tryParse(std::string_view(text, size), true);
+            if (!result) malformedFractionLiteral(result.error());
+            return *result;
+        }
+
+#if !defined(__cpp_consteval) && defined(__GNUC__)
+        /// @brief A literal's value as a constant, so the compiler must compute it.
+        template <typename FractionT, char... Chars>
+        struct FractionLiteral {
+            static constexpr char text[sizeof...(Chars) + 1] = { Chars..., '\0' };
+            static constexpr FractionT value = fractionLiteral<FractionT>(text, sizeof...(Chars));
+        };
+#endif
+    }
+
+    /// @brief Fraction literals, parsed and reduced by the compiler: `"3/4"_frac`,
+    /// `"-1 1/2"_frac64`. Same syntax as the `std::string_view` constructor. A malformed
+    /// literal, a zero denominator or a component that does not fit is a compile error. Always
+    /// evaluated at compile time with C++20 (consteval) and, in C++17, with GCC and Clang
+    /// (through their string literal operator templates). Elsewhere they are constexpr:
+    /// initialize a constexpr variable to be sure.
+    /// Found by `using namespace FracLib;` or `using namespace FracLib::literals;`.
+    /// @example constexpr auto quarter = "2/8"_frac; // 1/4
+    inline namespace literals {
+#if !defined(__cpp_consteval) && defined(__GNUC__)
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#else
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+        template <typename CharT, CharT... Chars>
+        constexpr Fraction operator""_frac() {
+            static_assert(std::is_same<CharT, char>::value, "Fraction literals are narrow strings.");
+            return detail::FractionLiteral<Fraction, Chars...>::value;
+        }
+        template <typename CharT, CharT... Chars>
+        constexpr Fraction64 operator""_frac64() {
+            static_assert(std::is_same<CharT, char>::value, "Fraction literals are narrow strings.");
+            return detail::FractionLiteral<Fraction64, Chars...>::value;
+        }
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#else
+#pragma GCC diagnostic pop
+#endif
+#else
+        FRACLIB_CONSTEVAL Fraction operator""_frac(const char* text, std::size_t size) {
+            return detail::fractionLiteral<Fraction>(text, size);
+        }
+        FRACLIB_CONSTEVAL Fraction64 operator""_frac64(const char* text, std::size_t size) {
+            return detail::fractionLiteral<Fraction64>(text, size);
+        }
+#endif
+    }
 
+#ifndef FRACLIB_HEADER_ONLY
+    // The common widths are instantiated once in the Fraction library (src/fraction.cpp).
+    // The constexpr core is inline either way; this only affects the string, stream and
+    // double conversion members. Define FRACLIB_HEADER_ONLY (or link FracLib::FractionHeaderOnly)
+    // to instantiate everything in the including translation unit instead.
+    extern template class BasicFraction<std::int16_t>;
+    extern template class BasicFraction<std::int32_t>;
+    extern template class BasicFraction<std::int64_t>;
+#ifdef FRACLIB_HAS_INT128
+    extern template class BasicFraction<int128_t>;
+#endif
+#endif
+}
+
+namespace std {
+    /// @brief Hashes the value, so fractions that compare equal hash equally. Fractions known
+    /// to be reduced (see `knownReduced`) hash their components directly; others are reduced first.
+    template <typename IntT, typename OverflowPolicy>
+    struct hash<FracLib::BasicFraction<IntT, OverflowPolicy>> {
+        std::size_t operator()(const FracLib::BasicFraction<IntT, OverflowPolicy>& value) const noexcept {
+            static_assert(FracLib::FractionTraits<IntT>::is_bounded, "std::hash is provided for built-in storage types only.");
+            using U = FracLib::detail::UnsignedOfT<IntT>;
+            U n = FracLib::detail::magnitude(value.numerator);
+            U d = FracLib::detail::magnitude(value.denominator);
+            if (!value.knownReduced()) {
+                U g = FracLib::detail::gcdMagnitude(n, d);
+                n /= g;
+                d /= g;
+            }
+            bool negative = n != 0 && ((value.numerator < 0) != (value.denominator < 0));
+            return FracLib::detail::hashReduced(negative, n, d);
+        }
+    };
+}
@@ -0,0 +1,420 @@
+/**************************************************************************/
+/*  fraction_accumulator.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include "fraction.h"
+#include "bigint.h"
+#include "thread_pool.h"
+
+namespace FracLib {
+    namespace detail {
+        /// @brief x / y for positive x and y, in 64-bit arithmetic when both fit: 128-bit
+        /// division is a library call several times slower.
+        template <typename W>
+        constexpr W positiveQuotient(W x, W y) noexcept {
+            if constexpr (sizeof(W) > sizeof(std::uint64_t)) {
+                if (((x | y) >> 64) == 0) return static_cast<W>(static_cast<std::uint64_t>(x) / static_cast<std::uint64_t>(y));
+            }
+            return x / y;
+        }
+    }
+
+    /// @brief Exact running sum or product of fractions. A sum keeps the least common multiple
+    /// of the denominators seen so far as its denominator, so values over a denominator it
+    /// already has cost one addition and denominators never compound the way they do with
+    /// `+=`. A product cancels common factors against the running value. The state is held in
+    /// `FractionTraits<IntT>::wide_type`; an operation that would overflow it reduces the state
+    /// first, and if it still does not fit the accumulator moves to BigInt for good. Nothing
+    /// overflows before `value()` narrows the exact result back to `IntT`.
+    /// @example FractionAccumulator<std::int32_t> sum; for (const Fraction32& f : values) sum += f; Fraction32 total = sum.value();
+    template <typename IntT, typename OverflowPolicy = ThrowOnOverflow>
+    class FractionAccumulator {
+    public:
+        using fraction_type = BasicFraction<IntT, OverflowPolicy>;
+        /// @brief Type the state is kept in until it needs BigInt.
+        using backing_type = typename FractionTraits<IntT>::wide_type;
+
+        /// @brief Additions between reductions once the state is a BigInt, so a numerator that
+        /// shares factors with the common denominator does not keep growing.
+        static constexpr unsigned REDUCE_INTERVAL = 64;
+
+    public: // CONSTRUCTORS
+        /// @brief Starts at 0, for sums.
+        FractionAccumulator() = default;
+        /// @brief Starts at `initial`; use 1 for products.
+        explicit FractionAccumulator(const fraction_type& initial);
+
+    public: // OPERATORS
+        FractionAccumulator& operator+=(const fraction_type& value);
+        FractionAccumulator& operator-=(const fraction_type& value);
+        FractionAccumulator& operator*=(const fraction_type& value);
+        /// @throws std::invalid_argument If `value` is zero.
+        FractionAccumulator& operator/=(const fraction_type& value);
+        /// @brief Adds another accumulator's exact value, e.g. a partial sum from another thread.
+        FractionAccumulator& operator+=(const FractionAccumulator& other);
+        /// @brief Multiplies by another accumulator's exact value.
+        FractionAccumulator& operator*=(const FractionAccumulator& other);
+
+    public: // METHODS
+        /// @brief The exact result in lowest terms, narrowed to `IntT`. A result that does not
+        /// fit is handed to the overflow policy like any arithmetic result (components too
+        /// large even for `backing_type` are first scaled down to fit it).
+        fraction_type value() const;
+        /// @brief The exact result in lowest terms. Never overflows.
+        BigFraction exactValue() const;
+        /// @brief Whether the state has moved to BigInt.
+        bool promoted() const noexcept { return promoted_; }
+
+    private:
+        void addTerm(backing_type a, backing_type b);
+        void multiplyTerm(backing_type a, backing_type b);
+        /// @brief State += a/b in `backing_type` (b nonzero).
+        /// @return false, with the state unchanged, if an intermediate overflows.
+        bool addBacking(backing_type a, backing_type b) noexcept;
+        /// @brief State *= a/b in `backing_type` (b nonzero).
+        /// @return false, with the state unchanged, if an intermediate overflows.
+        bool multiplyBacking(backing_type a, backing_type b) noexcept;
+        void reduceBacking() noexcept;
+        void addBig(BigInt a, BigInt b);
+        void multiplyBig(BigInt a, BigInt b);
+        void reduceBig();
+        void promote();
+        BigInt bigNumerator() const { return promoted_ ? bigN_ : BigInt(n_); }
+        BigInt bigDenominator() const { return promoted_ ? bigD_ : BigInt(d_); }
+
+        // The value is n_/d_ until promoted, then bigN_/bigD_. Denominators are positive.
+        backing_type n_ = 0;
+        backing_type d_ = 1;
+        BigInt bigN_;
+        BigInt bigD_ = 1;
+        bool promoted_ = !FractionTraits<IntT>::is_bounded;
+        unsigned pending_ = 0;
+    };
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>::FractionAccumulator(const fraction_type& initial) {
+        *this += initial;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>& FractionAccumulator<IntT, OverflowPolicy>::operator+=(const fraction_type& value) {
+        addTerm(backing_type(value.numerator), backing_type(value.denominator));
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>& FractionAccumulator<IntT, OverflowPolicy>::operator-=(const fraction_type& value) {
+        // Negated in backing_type, which holds -min for every type but the widest
+        if constexpr (FractionTraits<IntT>::is_bounded) {
+            backing_type negated = 0;
+            if (!detail::subOverflow(backing_type(0), backing_type(value.numerator), negated)) {
+                addTerm(negated, backing_type(value.denominator));
+            } else {
+                if (!promoted_) promote();
+                addBig(-BigInt(value.numerator), BigInt(value.denominator));
+            }
+        } else {
+            addTerm(-value.numerator, value.denominator);
+        }
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>& FractionAccumulator<IntT, OverflowPolicy>::operator*=(const fraction_type& value) {
+        multiplyTerm(backing_type(value.numerator), backing_type(value.denominator));
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>& FractionAccumulator<IntT, OverflowPolicy>::operator/=(const fraction_type& value) {
+        if (value.numerator == 0) {
+            detail::throwError(std::invalid_argument(fraction_type::ZERO_DIVISOR_ERROR));
+        }
+        multiplyTerm(backing_type(value.denominator), backing_type(value.numerator));
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>& FractionAccumulator<IntT, OverflowPolicy>::operator+=(const FractionAccumulator& other) {
+        if (!promoted_ && !other.promoted_) {
+            addTerm(other.n_, other.d_);
+        } else {
+            if (!promoted_) promote();
+            addBig(other.bigNumerator(), other.bigDenominator());
+        }
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    FractionAccumulator<IntT, OverflowPolicy>& FractionAccumulator<IntT, OverflowPolicy>::operator*=(const FractionAccumulator& other) {
+        if (!promoted_ && !other.promoted_) {
+            multiplyTerm(other.n_, other.d_);
+        } else {
+            if (!promoted_) promote();
+            multiplyBig(other.bigNumerator(), other.bigDenominator());
+        }
+        return *this;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    typename FractionAccumulator<IntT, OverflowPolicy>::fraction_type FractionAccumulator<IntT, OverflowPolicy>::value() const {
+        if constexpr (!FractionTraits<IntT>::is_bounded) {
+            return fraction_type(bigN_, bigD_, true);
+        } else {
+            if (promoted_) return detail::narrowBigFraction<fraction_type>(bigN_, bigD_);
+            FractionAccumulator reduced = *this;
+            reduced.reduceBacking();
+            backing_type n = reduced.n_, d = reduced.d_;
+            IntT tn = 0, td = 0;
+            if (!(detail::convertOverflow(n, tn) | detail::convertOverflow(d, td))) return fraction_type(tn, td);
+            return OverflowPolicy::template narrowFraction<fraction_type>(n, d);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    BigFraction FractionAccumulator<IntT, OverflowPolicy>::exactValue() const {
+        return BigFraction(bigNumerator(), bigDenominator(), true);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::addTerm(backing_type a, backing_type b) {
+        if constexpr (FractionTraits<IntT>::is_bounded) {
+            if (!promoted_) {
+                if (addBacking(a, b)) return;
+                reduceBacking();
+                if (addBacking(a, b)) return;
+                promote();
+            }
+        }
+        addBig(BigInt(a), BigInt(b));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::multiplyTerm(backing_type a, backing_type b) {
+        if constexpr (FractionTraits<IntT>::is_bounded) {
+            if (!promoted_) {
+                if (multiplyBacking(a, b)) return;
+                promote();
+            }
+        }
+        multiplyBig(BigInt(a), BigInt(b));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    bool FractionAccumulator<IntT, OverflowPolicy>::addBacking(backing_type a, backing_type b) noexcept {
+        if constexpr (FractionTraits<IntT>::is_bounded) {
+            using W = backing_type;
+            if (b < 0 && (detail::subOverflow(W(0), a, a) || detail::subOverflow(W(0), b, b))) return false;
+            W n = 0, d = 0;
+            if (b == d_) {
+                // Common denominator: a single addition
+                if (detail::addOverflow(n_, a, n)) return false;
+                n_ = n;
+                return true;
+            }
+            W g = static_cast<W>(detail::gcdMagnitude(detail::magnitude(d_), detail::magnitude(b)));
+            W bg = detail::positiveQuotient(b, g);
+            W left = 0, right = 0;
+            if (detail::mulOverflow(n_, bg, left) | detail::mulOverflow(a, detail::positiveQuotient(d_, g), right) |
+                detail::addOverflow(left, right, n) | detail::mulOverflow(d_, bg, d)) return false;
+            n_ = n;
+            d_ = d;
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    bool FractionAccumulator<IntT, OverflowPolicy>::multiplyBacking(backing_type a, backing_type b) noexcept {
+        if constexpr (FractionTraits<IntT>::is_bounded) {
+            using W = backing_type;
+            if (b < 0 && (detail::subOverflow(W(0), a, a) || detail::subOverflow(W(0), b, b))) return false;
+            if (a == 0 || n_ == 0) {
+                n_ = 0;
+                d_ = 1;
+                return true;
+            }
+            W g1 = static_cast<W>(detail::gcdMagnitude(detail::magnitude(n_), detail::magnitude(b)));
+            W g2 = static_cast<W>(detail::gcdMagnitude(detail::magnitude(a), detail::magnitude(d_)));
+            W n = 0, d = 0;
+            if (detail::mulOverflow(W(n_ / g1), W(a / g2), n) |
+                detail::mulOverflow(detail::positiveQuotient(d_, g2), detail::positiveQuotient(b, g1), d)) return false;
+            n_ = n;
+            d_ = d;
+            return true;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::reduceBacking() noexcept {
+        if constexpr (FractionTraits<IntT>::is_bounded) {
+            backing_type g = static_cast<backing_type>(detail::gcdMagnitude(detail::magnitude(n_), detail::magnitude(d_)));
+            n_ /= g;
+            d_ /= g;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::addBig(BigInt a, BigInt b) {
+        if (b.isNegative()) {
+            a = -a;
+            b = -b;
+        }
+        if (b == bigD_) {
+            bigN_ += a;
+        } else {
+            BigInt g = gcd(bigD_, b);
+            BigInt bg = b / g;
+            bigN_ = bigN_ * bg + a * (bigD_ / g);
+            bigD_ *= bg;
+        }
+        if (++pending_ == REDUCE_INTERVAL) reduceBig();
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::multiplyBig(BigInt a, BigInt b) {
+        if (b.isNegative()) {
+            a = -a;
+            b = -b;
+        }
+        if (a.isZero() || bigN_.isZero()) {
+            bigN_ = 0;
+            bigD_ = 1;
+            return;
+        }
+        BigInt g1 = gcd(bigN_, b);
+        BigInt g2 = gcd(a, bigD_);
+        bigN_ = (bigN_ / g1) * (a / g2);
+        bigD_ = (bigD_ / g2) * (b / g1);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::reduceBig() {
+        BigInt g = gcd(bigN_, bigD_);
+        if (g != 1) {
+            bigN_ /= g;
+            bigD_ /= g;
+        }
+        pending_ = 0;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void FractionAccumulator<IntT, OverflowPolicy>::promote() {
+        bigN_ = BigInt(n_);
+        bigD_ = BigInt(d_);
+        promoted_ = true;
+        pending_ = 0;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Parallel Reduction
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Elements each leaf of the reduction tree accumulates. Fixed, so the tree's
+        /// shape depends only on the input size, not on the pool.
+        inline constexpr std::size_t reductionLeafSize = 4096;
+
+        /// @brief Accumulates `count` fractions in leaves of `reductionLeafSize` on `pool`, then
+        /// combines the leaves pairwise, level by level (leaf i absorbs leaf i + stride).
+        template <typename FractionT, typename RandomIt>
+        FractionAccumulator<typename FractionT::value_type, typename FractionT::policy_type>
+        treeReduce(RandomIt first, std::size_t count, bool product, ThreadPool& pool) {
+            using Accumulator = FractionAccumulator<typename FractionT::value_type, typename FractionT::policy_type>;
+            const Accumulator identity = product ? Accumulator(FractionT(1)) : Accumulator();
+            std::size_t leaves = (count + reductionLeafSize - 1) / reductionLeafSize;
+            if (leaves == 0) return identity;
+
+            std::vector<Accumulator> partial(leaves, identity);
+            pool.parallelFor(leaves, [&](std::size_t i) {
+                std::size_t begin = i * reductionLeafSize;
+                std::size_t end = std::min(count, begin + reductionLeafSize);
+                Accumulator& accumulator = partial[i];
+                for (std::size_t k = begin; k < end; ++k) {
+                    if (product) {
+                        accumulator *= first[k];
+                    } else {
+                        accumulator += first[k];
+                    }
+                }
+            });
+            for (std::size_t stride = 1; stride < leaves; stride *= 2) {
+                std::size_t pairs = (leaves - stride - 1) / (2 * stride) + 1;
+                pool.parallelFor(pairs, [&](std::size_t p) {
+                    std::size_t i = p * 2 * stride;
+                    if (product) {
+                        partial[i] *= partial[i + stride];
+                    } else {
+                        partial[i] += partial[i + stride];
+                    }
+                });
+            }
+            return partial[0];
+        }
+    }
+
+    /// @brief Exact sum of `[first, last)` on a thread pool, in lowest terms. Every partial sum
+    /// is exact, so the result is identical to a sequential FractionAccumulator's `value()`
+    /// (including what the overflow policy does with a total that does not fit) whatever the
+    /// pool size. 0 for an empty range.
+    /// @param pool Pool to run on. nullptr uses ThreadPool::shared().
+    /// @example Fraction64 total = parallelSum(values.begin(), values.end());
+    template <typename RandomIt, typename FractionT = typename std::iterator_traits<RandomIt>::value_type>
+    FractionT parallelSum(RandomIt first, RandomIt last, ThreadPool* pool = nullptr) {
+        return detail::treeReduce<FractionT>(first, static_cast<std::size_t>(last - first), false,
+            pool ? *pool : ThreadPool::shared()).value();
+    }
+
+    /// @brief Exact product of `[first, last)` on a thread pool, see parallelSum. 1 for an
+    /// empty range.
+    /// @example Fraction64 product = parallelProduct(values.begin(), values.end());
+    template <typename RandomIt, typename FractionT = typename std::iterator_traits<RandomIt>::value_type>
+    FractionT parallelProduct(RandomIt first, RandomIt last, ThreadPool* pool = nullptr) {
+        return detail::treeReduce<FractionT>(first, static_cast<std::size_t>(last - first), true,
+            pool ? *pool : ThreadPool::shared()).value();
+    }
+}
@@ -0,0 +1,181 @@
+/**************************************************************************/
+/*  fraction_array.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <new>
+#include <vector>
+#include "fraction.h"
+
+namespace FracLib {
+    /// @brief Allocator returning memory aligned to `Alignment` bytes, so SIMD kernels can
+    /// use aligned loads.
+    template <typename T, std::size_t Alignment>
+    struct AlignedAllocator {
+        using value_type = T;
+        template <typename U> struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+        AlignedAllocator() noexcept = default;
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+        void deallocate(T* p, std::size_t) noexcept {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+        template <typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+    };
+
+    /// @brief Instruction set used by the batch kernels.
+    enum class SimdLevel {
+        Scalar,
+        SSE4, ///< SSE4.2
+        AVX2,
+    };
+
+    /// @brief Best instruction set the running CPU supports (Scalar on non-x86 targets or
+    /// when built with FRACLIB_DISABLE_SIMD).
+    SimdLevel supportedSimdLevel() noexcept;
+    /// @brief Instruction set the batch kernels currently use. Defaults to supportedSimdLevel().
+    SimdLevel activeSimdLevel() noexcept;
+    /// @brief Selects the instruction set for the batch kernels, e.g. to compare them in a
+    /// benchmark. Levels above supportedSimdLevel() are clamped to it.
+    void setSimdLevel(SimdLevel level) noexcept;
+
+    /// @brief One flag per element: non-zero where a batch operation could not produce a
+    /// result (overflow or division by zero).
+    using OverflowMask = std::vector<std::uint8_t>;
+
+    /// @brief Fractions with `int32_t` components stored as a structure of arrays: all
+    /// numerators in one 32-byte aligned array, all denominators in another. Element-wise
+    /// arithmetic runs through the batch kernels below instead of one operator call per
+    /// element.
+    class FractionArray {
+    public:
+        using value_type = Fraction32;
+        using component_vector = std::vector<std::int32_t, AlignedAllocator<std::int32_t, 32>>;
+
+    public: // CONSTRUCTORS
+        FractionArray() = default;
+        /// @brief `count` fractions initialized to `0/1`.
+        explicit FractionArray(std::size_t count) : numerators_(count, 0), denominators_(count, 1) {}
+        /// @example FractionArray a = {Fraction32(1, 2), Fraction32(3, 4)};
+        FractionArray(std::initializer_list<Fraction32> values) {
+            reserve(values.size());
+            for (const Fraction32& f : values) push_back(f);
+        }
+
+    public: // METHODS
+        std::size_t size() const noexcept { return numerators_.size(); }
+        bool empty() const noexcept { return numerators_.empty(); }
+        void reserve(std::size_t count) {
+            numerators_.reserve(count);
+            denominators_.reserve(count);
+        }
+        /// @brief Grows with `0/1` elements or shrinks.
+        void resize(std::size_t count) {
+            numerators_.resize(count, 0);
+            denominators_.resize(count, 1);
+        }
+        void clear() noexcept {
+            numerators_.clear();
+            denominators_.clear();
+        }
+        void push_back(const Fraction32& value) {
+            numerators_.push_back(value.numerator);
+            denominators_.push_back(value.denominator);
+        }
+        /// @brief Element `index` as a fraction (a copy; use set() to modify).
+        Fraction32 operator[](std::size_t index) const {
+            return Fraction32(numerators_[index], denominators_[index]);
+        }
+        void set(std::size_t index, const Fraction32& value) {
+            numerators_[index] = value.numerator;
+            denominators_[index] = value.denominator;
+        }
+
+        std::int32_t* numerators() noexcept { return numerators_.data(); }
+        const std::int32_t* numerators() const noexcept { return numerators_.data(); }
+        std::int32_t* denominators() noexcept { return denominators_.data(); }
+        const std::int32_t* denominators() const noexcept { return denominators_.data(); }
+
+    private:
+        component_vector numerators_;
+        component_vector denominators_;
+    };
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Batch Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Element-wise versions of the Fraction32 operators with the same results: nothing is
+    // simplified unless the result does not fit, in which case it is reduced first. Instead
+    // of throwing, an element that still overflows `int32_t` (or divides by zero) is flagged
+    // in `overflow` and stored as 0/1. `result` may be one of the inputs.
+    // Each returns the number of flagged elements.
+    // @throws std::invalid_argument If the input sizes differ.
+
+    /// @brief result[i] = a[i] + b[i]
+    std::size_t batchAdd(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = a[i] - b[i]
+    std::size_t batchSubtract(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = a[i] * b[i]
+    std::size_t batchMultiply(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = a[i] / b[i]. Zero divisors are flagged.
+    std::size_t batchDivide(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = -a[i]. An INT32_MIN numerator is reduced first, so only values
+    /// with no 32-bit form are flagged.
+    std::size_t batchNegate(const FractionArray& a, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = toReciprocal(a[i]). Zero numerators are flagged.
+    std::size_t batchReciprocal(const FractionArray& a, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = Fraction32(values[i]): the exact binary value of each double in
+    /// lowest terms, or the closest fraction that fits when it does not. NaN, infinities and
+    /// values outside Fraction32's range are flagged.
+    std::size_t batchFromDouble(const double* values, std::size_t count, FractionArray& result, OverflowMask& overflow);
+    /// @brief result[i] = Fraction32::limitDenominator(values[i], maxDenominator): the closest
+    /// fraction with a denominator of at most `maxDenominator`. NaN, infinities and results
+    /// that do not fit are flagged.
+    /// @throws std::invalid_argument If `maxDenominator` is less than 1.
+    std::size_t batchLimitDenominator(const double* values, std::size_t count, std::int32_t maxDenominator, FractionArray& result, OverflowMask& overflow);
+    /// @brief order[i] = -1, 0 or 1 as a[i] is less than, equal to or greater than b[i].
+    /// Exact (64-bit cross products) and correct for negative denominators.
+    void batchCompare(const FractionArray& a, const FractionArray& b, std::vector<std::int8_t>& order);
+}
+
+#ifdef FRACLIB_HEADER_ONLY
+#include "fraction_array_impl.h"
+#endif
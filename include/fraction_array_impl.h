@@ -0,0 +1,617 @@
+/**************************************************************************/
+/*  fraction_array_impl.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+// Out-of-line definitions for FractionArray's batch kernels. Compiled by
+// src/fraction_array.cpp, or included by fraction_array.h in header-only mode; do not
+// include directly.
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+// The SIMD kernels are compiled with per-function target attributes and selected at run
+// time, so the library itself does not need -mavx2. Define FRACLIB_DISABLE_SIMD to build the
+// scalar kernels only.
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(FRACLIB_DISABLE_SIMD)
+#define FRACLIB_X86_SIMD 1
+#include <immintrin.h>
+#define FRACLIB_TARGET_AVX2 __attribute__((target("avx2")))
+#define FRACLIB_TARGET_SSE4 __attribute__((target("sse4.2")))
+#endif
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // SIMD Level
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        FRACLIB_INLINE std::atomic<int>& simdLevelSetting() noexcept {
+            static std::atomic<int> level(static_cast<int>(supportedSimdLevel()));
+            return level;
+        }
+    }
+
+    FRACLIB_INLINE SimdLevel supportedSimdLevel() noexcept {
+#ifdef FRACLIB_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.2")) return SimdLevel::SSE4;
+#endif
+        return SimdLevel::Scalar;
+    }
+
+    FRACLIB_INLINE SimdLevel activeSimdLevel() noexcept {
+        return static_cast<SimdLevel>(detail::simdLevelSetting().load(std::memory_order_relaxed));
+    }
+
+    FRACLIB_INLINE void setSimdLevel(SimdLevel level) noexcept {
+        if (static_cast<int>(level) > static_cast<int>(supportedSimdLevel())) level = supportedSimdLevel();
+        detail::simdLevelSetting().store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Scalar Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        enum class BinaryOp { Add, Subtract, Multiply, Divide };
+
+        /// @brief Input and output columns of a batch operation.
+        struct BatchColumns {
+            const std::int32_t* an;
+            const std::int32_t* ad;
+            const std::int32_t* bn;
+            const std::int32_t* bd;
+            std::int32_t* rn;
+            std::int32_t* rd;
+            std::uint8_t* overflow;
+        };
+
+        // Products of two int32 values always fit in int64; only the add/sub of two
+        // products can leave int64, which the builtin reports.
+        /// @brief Lane `i`'s unreduced result in int64.
+        /// @return false on division by zero or if the result leaves int64.
+        template <BinaryOp Op>
+        inline bool laneExact(const BatchColumns& c, std::size_t i, std::int64_t& n, std::int64_t& d) noexcept {
+            std::int64_t an = c.an[i], ad = c.ad[i], bn = c.bn[i], bd = c.bd[i];
+            bool bad = false;
+            if constexpr (Op == BinaryOp::Add) {
+                bad = __builtin_add_overflow(an * bd, bn * ad, &n);
+                d = ad * bd;
+            } else if constexpr (Op == BinaryOp::Subtract) {
+                bad = __builtin_sub_overflow(an * bd, bn * ad, &n);
+                d = ad * bd;
+            } else if constexpr (Op == BinaryOp::Multiply) {
+                n = an * bn;
+                d = ad * bd;
+            } else {
+                n = an * bd;
+                d = ad * bn;
+                bad = bn == 0;
+            }
+            return !bad;
+        }
+
+        template <BinaryOp Op>
+        std::size_t binaryScalar(const BatchColumns& c, std::size_t begin, std::size_t end) noexcept {
+            std::size_t flagged = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                std::int64_t n = 0, d = 0;
+                bool bad = !laneExact<Op>(c, i, n, d);
+                bad = bad || n != static_cast<std::int32_t>(n) || d != static_cast<std::int32_t>(d);
+                c.rn[i] = bad ? 0 : static_cast<std::int32_t>(n);
+                c.rd[i] = bad ? 1 : static_cast<std::int32_t>(d);
+                c.overflow[i] = bad;
+                flagged += bad;
+            }
+            return flagged;
+        }
+
+        inline std::size_t negateScalar(const BatchColumns& c, std::size_t begin, std::size_t end) noexcept {
+            std::size_t flagged = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                std::int32_t n = c.an[i], d = c.ad[i];
+                std::int32_t rn = 0, rd = 1;
+                bool bad = false;
+                if (n != INT32_MIN) {
+                    rn = -n;
+                    rd = d;
+                } else {
+                    // 2^31 / d fits only once reduced, as in Fraction32::operator-
+                    std::uint64_t ud = magnitude(static_cast<std::int64_t>(d));
+                    std::uint64_t g = gcdMagnitude(std::uint64_t(1) << 31, ud);
+                    std::uint64_t p = (std::uint64_t(1) << 31) / g, q = ud / g;
+                    bool negative = d < 0;
+                    bad = q > INT32_MAX || p > std::uint64_t(INT32_MAX) + negative;
+                    if (!bad) {
+                        rn = static_cast<std::int32_t>(static_cast<std::uint32_t>(negative ? 0 - p : p));
+                        rd = static_cast<std::int32_t>(q);
+                    }
+                }
+                c.rn[i] = rn;
+                c.rd[i] = rd;
+                c.overflow[i] = bad;
+                flagged += bad;
+            }
+            return flagged;
+        }
+
+        inline std::size_t reciprocalScalar(const BatchColumns& c, std::size_t begin, std::size_t end) noexcept {
+            std::size_t flagged = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                std::int32_t n = c.an[i], d = c.ad[i];
+                bool bad = n == 0;
+                c.rn[i] = bad ? 0 : d;
+                c.rd[i] = bad ? 1 : n;
+                c.overflow[i] = bad;
+                flagged += bad;
+            }
+            return flagged;
+        }
+
+        // a < b  <=>  an * bd < bn * ad when ad * bd > 0, reversed otherwise
+        inline void compareScalar(const BatchColumns& c, std::int8_t* order, std::size_t begin, std::size_t end) noexcept {
+            for (std::size_t i = begin; i < end; ++i) {
+                std::int64_t left = static_cast<std::int64_t>(c.an[i]) * c.bd[i];
+                std::int64_t right = static_cast<std::int64_t>(c.bn[i]) * c.ad[i];
+                int result = (left > right) - (left < right);
+                order[i] = static_cast<std::int8_t>(((c.ad[i] ^ c.bd[i]) < 0) ? -result : result);
+            }
+        }
+
+
+        //\\\\\\\\\\\\\\\\\\\\/
+        // AVX2 Kernels
+        //\\\\\\\\\\\\\\\\\\\\/
+        // 8 elements per iteration, as two halves of four 64-bit lanes (_mm256_mul_epi32 gives
+        // exact signed 32x32->64 products).
+#ifdef FRACLIB_X86_SIMD
+        FRACLIB_TARGET_AVX2 inline __m256i outOfInt32Avx2(__m256i v) noexcept {
+            const __m256i max = _mm256_set1_epi64x(INT32_MAX);
+            const __m256i min = _mm256_set1_epi64x(INT32_MIN);
+            return _mm256_or_si256(_mm256_cmpgt_epi64(v, max), _mm256_cmpgt_epi64(min, v));
+        }
+
+        /// @brief Low 32 bits of four 64-bit lanes.
+        FRACLIB_TARGET_AVX2 inline __m128i narrowAvx2(__m256i v) noexcept {
+            return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+        }
+
+        /// @brief Expands the low `lanes` (4 or 8) bits of a movemask to one 0/1 byte each:
+        /// replicate the byte, keep bit k in byte k, then turn non-zero bytes into 1.
+        inline void storeMaskBits(std::uint8_t* out, unsigned bits, int lanes) noexcept {
+            std::uint64_t spread = (static_cast<std::uint64_t>(bits & 0xFFu) * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+            spread = ((spread + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+            std::memcpy(out, &spread, static_cast<std::size_t>(lanes)); // x86 is little-endian
+        }
+
+        /// @brief Four lanes of a binary operation; returns the overflow lanes as bits.
+        template <BinaryOp Op>
+        FRACLIB_TARGET_AVX2 inline unsigned binaryQuadAvx2(__m128i an4, __m128i ad4, __m128i bn4, __m128i bd4, __m128i& rn4, __m128i& rd4) noexcept {
+            __m256i an = _mm256_cvtepi32_epi64(an4), ad = _mm256_cvtepi32_epi64(ad4);
+            __m256i bn = _mm256_cvtepi32_epi64(bn4), bd = _mm256_cvtepi32_epi64(bd4);
+            __m256i n, d;
+            if constexpr (Op == BinaryOp::Add) {
+                n = _mm256_add_epi64(_mm256_mul_epi32(an, bd), _mm256_mul_epi32(bn, ad));
+                d = _mm256_mul_epi32(ad, bd);
+            } else if constexpr (Op == BinaryOp::Subtract) {
+                n = _mm256_sub_epi64(_mm256_mul_epi32(an, bd), _mm256_mul_epi32(bn, ad));
+                d = _mm256_mul_epi32(ad, bd);
+            } else if constexpr (Op == BinaryOp::Multiply) {
+                n = _mm256_mul_epi32(an, bn);
+                d = _mm256_mul_epi32(ad, bd);
+            } else {
+                n = _mm256_mul_epi32(an, bd);
+                d = _mm256_mul_epi32(ad, bn);
+            }
+            // A sum of two products that wraps int64 lands outside int32 as well
+            __m256i bad = _mm256_or_si256(outOfInt32Avx2(n), outOfInt32Avx2(d));
+            if constexpr (Op == BinaryOp::Divide) {
+                bad = _mm256_or_si256(bad, _mm256_cmpeq_epi64(bn, _mm256_setzero_si256()));
+            }
+            n = _mm256_andnot_si256(bad, n);
+            d = _mm256_blendv_epi8(d, _mm256_set1_epi64x(1), bad);
+            rn4 = narrowAvx2(n);
+            rd4 = narrowAvx2(d);
+            return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(bad)));
+        }
+
+        template <BinaryOp Op>
+        FRACLIB_TARGET_AVX2 std::size_t binaryAvx2(const BatchColumns& c, std::size_t count) noexcept {
+            std::size_t flagged = 0, i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i an = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.an + i));
+                __m256i ad = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.ad + i));
+                __m256i bn = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.bn + i));
+                __m256i bd = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.bd + i));
+                __m128i nLow, dLow, nHigh, dHigh;
+                unsigned bits = binaryQuadAvx2<Op>(_mm256_castsi256_si128(an), _mm256_castsi256_si128(ad),
+                    _mm256_castsi256_si128(bn), _mm256_castsi256_si128(bd), nLow, dLow);
+                bits |= binaryQuadAvx2<Op>(_mm256_extracti128_si256(an, 1), _mm256_extracti128_si256(ad, 1),
+                    _mm256_extracti128_si256(bn, 1), _mm256_extracti128_si256(bd, 1), nHigh, dHigh) << 4;
+                _mm256_store_si256(reinterpret_cast<__m256i*>(c.rn + i), _mm256_inserti128_si256(_mm256_castsi128_si256(nLow), nHigh, 1));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(c.rd + i), _mm256_inserti128_si256(_mm256_castsi128_si256(dLow), dHigh, 1));
+                storeMaskBits(c.overflow + i, bits, 8);
+                flagged += static_cast<std::size_t>(__builtin_popcount(bits));
+            }
+            return flagged + binaryScalar<Op>(c, i, count);
+        }
+
+        FRACLIB_TARGET_AVX2 inline std::size_t negateAvx2(const BatchColumns& c, std::size_t count) noexcept {
+            const __m256i min = _mm256_set1_epi32(INT32_MIN);
+            std::size_t flagged = 0, i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i n = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.an + i));
+                __m256i d = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.ad + i));
+                __m256i bad = _mm256_cmpeq_epi32(n, min);
+                if (!_mm256_testz_si256(bad, bad)) {
+                    // INT32_MIN may still negate once reduced; rare, so leave it to the scalar path
+                    flagged += negateScalar(c, i, i + 8);
+                    continue;
+                }
+                _mm256_store_si256(reinterpret_cast<__m256i*>(c.rn + i), _mm256_sub_epi32(_mm256_setzero_si256(), n));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(c.rd + i), d);
+                std::memset(c.overflow + i, 0, 8);
+            }
+            return flagged + negateScalar(c, i, count);
+        }
+
+        FRACLIB_TARGET_AVX2 inline std::size_t reciprocalAvx2(const BatchColumns& c, std::size_t count) noexcept {
+            const __m256i one = _mm256_set1_epi32(1);
+            std::size_t flagged = 0, i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256i n = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.an + i));
+                __m256i d = _mm256_load_si256(reinterpret_cast<const __m256i*>(c.ad + i));
+                __m256i bad = _mm256_cmpeq_epi32(n, _mm256_setzero_si256());
+                _mm256_store_si256(reinterpret_cast<__m256i*>(c.rn + i), _mm256_andnot_si256(bad, d));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(c.rd + i), _mm256_blendv_epi8(n, one, bad));
+                unsigned bits = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(bad)));
+                storeMaskBits(c.overflow + i, bits, 8);
+                flagged += static_cast<std::size_t>(__builtin_popcount(bits));
+            }
+            return flagged + reciprocalScalar(c, i, count);
+        }
+
+        FRACLIB_TARGET_AVX2 inline void compareAvx2(const BatchColumns& c, std::int8_t* order, std::size_t count) noexcept {
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m256i an = _mm256_cvtepi32_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(c.an + i)));
+                __m256i ad = _mm256_cvtepi32_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(c.ad + i)));
+                __m256i bn = _mm256_cvtepi32_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(c.bn + i)));
+                __m256i bd = _mm256_cvtepi32_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(c.bd + i)));
+                __m256i left = _mm256_mul_epi32(an, bd);
+                __m256i right = _mm256_mul_epi32(bn, ad);
+                unsigned greater = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(left, right))));
+                unsigned less = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(right, left))));
+                unsigned flip = static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_xor_si256(ad, bd))));
+                for (int k = 0; k < 4; ++k) {
+                    int result = static_cast<int>((greater >> k) & 1u) - static_cast<int>((less >> k) & 1u);
+                    order[i + k] = static_cast<std::int8_t>(((flip >> k) & 1u) ? -result : result);
+                }
+            }
+            compareScalar(c, order, i, count);
+        }
+
+
+        //\\\\\\\\\\\\\\\\\\\\/
+        // SSE4.2 Kernels
+        //\\\\\\\\\\\\\\\\\\\\/
+        // 4 elements per iteration, as two halves of two 64-bit lanes.
+        FRACLIB_TARGET_SSE4 inline __m128i outOfInt32Sse4(__m128i v) noexcept {
+            const __m128i max = _mm_set1_epi64x(INT32_MAX);
+            const __m128i min = _mm_set1_epi64x(INT32_MIN);
+            return _mm_or_si128(_mm_cmpgt_epi64(v, max), _mm_cmpgt_epi64(min, v));
+        }
+
+        /// @brief Low 32 bits of the 64-bit lanes of `low` and `high`, in order.
+        FRACLIB_TARGET_SSE4 inline __m128i narrowSse4(__m128i low, __m128i high) noexcept {
+            return _mm_unpacklo_epi64(_mm_shuffle_epi32(low, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_epi32(high, _MM_SHUFFLE(2, 0, 2, 0)));
+        }
+
+        template <BinaryOp Op>
+        FRACLIB_TARGET_SSE4 inline __m128i binaryPairSse4(__m128i an, __m128i ad, __m128i bn, __m128i bd, __m128i& n, __m128i& d) noexcept {
+            if constexpr (Op == BinaryOp::Add) {
+                n = _mm_add_epi64(_mm_mul_epi32(an, bd), _mm_mul_epi32(bn, ad));
+                d = _mm_mul_epi32(ad, bd);
+            } else if constexpr (Op == BinaryOp::Subtract) {
+                n = _mm_sub_epi64(_mm_mul_epi32(an, bd), _mm_mul_epi32(bn, ad));
+                d = _mm_mul_epi32(ad, bd);
+            } else if constexpr (Op == BinaryOp::Multiply) {
+                n = _mm_mul_epi32(an, bn);
+                d = _mm_mul_epi32(ad, bd);
+            } else {
+                n = _mm_mul_epi32(an, bd);
+                d = _mm_mul_epi32(ad, bn);
+            }
+            __m128i bad = _mm_or_si128(outOfInt32Sse4(n), outOfInt32Sse4(d));
+            if constexpr (Op == BinaryOp::Divide) {
+                bad = _mm_or_si128(bad, _mm_cmpeq_epi64(bn, _mm_setzero_si128()));
+            }
+            n = _mm_andnot_si128(bad, n);
+            d = _mm_blendv_epi8(d, _mm_set1_epi64x(1), bad);
+            return bad;
+        }
+
+        template <BinaryOp Op>
+        FRACLIB_TARGET_SSE4 std::size_t binarySse4(const BatchColumns& c, std::size_t count) noexcept {
+            std::size_t flagged = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i an = _mm_load_si128(reinterpret_cast<const __m128i*>(c.an + i));
+                __m128i ad = _mm_load_si128(reinterpret_cast<const __m128i*>(c.ad + i));
+                __m128i bn = _mm_load_si128(reinterpret_cast<const __m128i*>(c.bn + i));
+                __m128i bd = _mm_load_si128(reinterpret_cast<const __m128i*>(c.bd + i));
+                __m128i nLow, dLow, nHigh, dHigh;
+                __m128i badLow = binaryPairSse4<Op>(_mm_cvtepi32_epi64(an), _mm_cvtepi32_epi64(ad),
+                    _mm_cvtepi32_epi64(bn), _mm_cvtepi32_epi64(bd), nLow, dLow);
+                __m128i badHigh = binaryPairSse4<Op>(_mm_cvtepi32_epi64(_mm_srli_si128(an, 8)), _mm_cvtepi32_epi64(_mm_srli_si128(ad, 8)),
+                    _mm_cvtepi32_epi64(_mm_srli_si128(bn, 8)), _mm_cvtepi32_epi64(_mm_srli_si128(bd, 8)), nHigh, dHigh);
+                _mm_store_si128(reinterpret_cast<__m128i*>(c.rn + i), narrowSse4(nLow, nHigh));
+                _mm_store_si128(reinterpret_cast<__m128i*>(c.rd + i), narrowSse4(dLow, dHigh));
+                unsigned bits = static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(badLow))) |
+                                static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(badHigh))) << 2;
+                storeMaskBits(c.overflow + i, bits, 4);
+                flagged += static_cast<std::size_t>(__builtin_popcount(bits));
+            }
+            return flagged + binaryScalar<Op>(c, i, count);
+        }
+
+        FRACLIB_TARGET_SSE4 inline std::size_t negateSse4(const BatchColumns& c, std::size_t count) noexcept {
+            const __m128i min = _mm_set1_epi32(INT32_MIN);
+            std::size_t flagged = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i n = _mm_load_si128(reinterpret_cast<const __m128i*>(c.an + i));
+                __m128i d = _mm_load_si128(reinterpret_cast<const __m128i*>(c.ad + i));
+                __m128i bad = _mm_cmpeq_epi32(n, min);
+                if (!_mm_testz_si128(bad, bad)) {
+                    flagged += negateScalar(c, i, i + 4);
+                    continue;
+                }
+                _mm_store_si128(reinterpret_cast<__m128i*>(c.rn + i), _mm_sub_epi32(_mm_setzero_si128(), n));
+                _mm_store_si128(reinterpret_cast<__m128i*>(c.rd + i), d);
+                std::memset(c.overflow + i, 0, 4);
+            }
+            return flagged + negateScalar(c, i, count);
+        }
+
+        FRACLIB_TARGET_SSE4 inline std::size_t reciprocalSse4(const BatchColumns& c, std::size_t count) noexcept {
+            const __m128i one = _mm_set1_epi32(1);
+            std::size_t flagged = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128i n = _mm_load_si128(reinterpret_cast<const __m128i*>(c.an + i));
+                __m128i d = _mm_load_si128(reinterpret_cast<const __m128i*>(c.ad + i));
+                __m128i bad = _mm_cmpeq_epi32(n, _mm_setzero_si128());
+                _mm_store_si128(reinterpret_cast<__m128i*>(c.rn + i), _mm_andnot_si128(bad, d));
+                _mm_store_si128(reinterpret_cast<__m128i*>(c.rd + i), _mm_blendv_epi8(n, one, bad));
+                unsigned bits = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(bad)));
+                storeMaskBits(c.overflow + i, bits, 4);
+                flagged += static_cast<std::size_t>(__builtin_popcount(bits));
+            }
+            return flagged + reciprocalScalar(c, i, count);
+        }
+
+        FRACLIB_TARGET_SSE4 inline void compareSse4(const BatchColumns& c, std::int8_t* order, std::size_t count) noexcept {
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                __m128i an = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c.an + i)));
+                __m128i ad = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c.ad + i)));
+                __m128i bn = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c.bn + i)));
+                __m128i bd = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c.bd + i)));
+                __m128i left = _mm_mul_epi32(an, bd);
+                __m128i right = _mm_mul_epi32(bn, ad);
+                unsigned greater = static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(left, right))));
+                unsigned less = static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(right, left))));
+                unsigned flip = static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(_mm_xor_si128(ad, bd))));
+                for (int k = 0; k < 2; ++k) {
+                    int result = static_cast<int>((greater >> k) & 1u) - static_cast<int>((less >> k) & 1u);
+                    order[i + k] = static_cast<std::int8_t>(((flip >> k) & 1u) ? -result : result);
+                }
+            }
+            compareScalar(c, order, i, count);
+        }
+#endif
+
+
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Dispatch
+        //\\\\\\\\\\\\\\\\\\\\/
+        inline BatchColumns prepareBatch(const FractionArray& a, const FractionArray* b, FractionArray& result, OverflowMask* overflow) {
+            if (b != nullptr && b->size() != a.size()) {
+                detail::throwError(std::invalid_argument("FractionArray sizes must match."));
+            }
+            result.resize(a.size());
+            if (overflow != nullptr) overflow->resize(a.size());
+            return BatchColumns{a.numerators(), a.denominators(),
+                b != nullptr ? b->numerators() : nullptr, b != nullptr ? b->denominators() : nullptr,
+                result.numerators(), result.denominators(), overflow != nullptr ? overflow->data() : nullptr};
+        }
+
+        /// @brief Gives flagged lanes the Fraction32 operators' second chance: a result that
+        /// does not fit is reduced before it counts as overflow. Reads the operands from
+        /// `source` and fixes up `out`. Overflow is rare, so this pass stays scalar.
+        template <BinaryOp Op>
+        std::size_t reduceFlagged(const BatchColumns& source, const BatchColumns& out, std::size_t count, std::size_t flagged) noexcept {
+            for (std::size_t i = 0; i < count && flagged != 0; ++i) {
+                if (!out.overflow[i]) continue;
+                std::int64_t n = 0, d = 0;
+                std::int32_t rn = 0, rd = 1;
+                if (!laneExact<Op>(source, i, n, d)) continue;
+                std::uint64_t un = magnitude(n), ud = magnitude(d);
+                std::uint64_t g = gcdMagnitude(un, ud);
+                if (!assignMagnitudes(un != 0 && ((n < 0) != (d < 0)), un / g, ud / g, rn, rd)) continue;
+                out.rn[i] = rn;
+                out.rd[i] = rd;
+                out.overflow[i] = 0;
+                --flagged;
+            }
+            return flagged;
+        }
+
+        template <BinaryOp Op>
+        std::size_t dispatchBinary(const BatchColumns& c, std::size_t count) noexcept {
+            switch (activeSimdLevel()) {
+#ifdef FRACLIB_X86_SIMD
+            case SimdLevel::AVX2: return binaryAvx2<Op>(c, count);
+            case SimdLevel::SSE4: return binarySse4<Op>(c, count);
+#endif
+            default: return binaryScalar<Op>(c, 0, count);
+            }
+        }
+
+        template <BinaryOp Op>
+        std::size_t runBinary(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow) {
+            BatchColumns c = prepareBatch(a, &b, result, &overflow);
+            const std::size_t count = a.size();
+            if (c.rn != c.an && c.rn != c.bn) {
+                std::size_t flagged = dispatchBinary<Op>(c, count);
+                return flagged == 0 ? 0 : reduceFlagged<Op>(c, c, count, flagged);
+            }
+            // In place: the kernels overwrite flagged lanes, so keep a copy of each block's
+            // aliased operand for reduceFlagged. Whole blocks keep the columns aligned.
+            constexpr std::size_t block = 1024;
+            std::int32_t savedN[block], savedD[block];
+            std::size_t total = 0;
+            for (std::size_t begin = 0; begin < count; begin += block) {
+                std::size_t length = count - begin < block ? count - begin : block;
+                BatchColumns part{c.an + begin, c.ad + begin, c.bn + begin, c.bd + begin,
+                    c.rn + begin, c.rd + begin, c.overflow + begin};
+                BatchColumns source = part;
+                std::memcpy(savedN, part.rn, length * sizeof(std::int32_t));
+                std::memcpy(savedD, part.rd, length * sizeof(std::int32_t));
+                if (part.an == part.rn) {
+                    source.an = savedN;
+                    source.ad = savedD;
+                }
+                if (part.bn == part.rn) {
+                    source.bn = savedN;
+                    source.bd = savedD;
+                }
+                std::size_t flagged = dispatchBinary<Op>(part, length);
+                total += flagged == 0 ? 0 : reduceFlagged<Op>(source, part, length, flagged);
+            }
+            return total;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Batch Kernels
+    //\\\\\\\\\\\\\\\\\\\\/
+    FRACLIB_INLINE std::size_t batchAdd(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow) {
+        return detail::runBinary<detail::BinaryOp::Add>(a, b, result, overflow);
+    }
+
+    FRACLIB_INLINE std::size_t batchSubtract(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow) {
+        return detail::runBinary<detail::BinaryOp::Subtract>(a, b, result, overflow);
+    }
+
+    FRACLIB_INLINE std::size_t batchMultiply(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow) {
+        return detail::runBinary<detail::BinaryOp::Multiply>(a, b, result, overflow);
+    }
+
+    FRACLIB_INLINE std::size_t batchDivide(const FractionArray& a, const FractionArray& b, FractionArray& result, OverflowMask& overflow) {
+        return detail::runBinary<detail::BinaryOp::Divide>(a, b, result, overflow);
+    }
+
+    FRACLIB_INLINE std::size_t batchNegate(const FractionArray& a, FractionArray& result, OverflowMask& overflow) {
+        detail::BatchColumns c = detail::prepareBatch(a, nullptr, result, &overflow);
+        switch (activeSimdLevel()) {
+#ifdef FRACLIB_X86_SIMD
+        case SimdLevel::AVX2: return detail::negateAvx2(c, a.size());
+        case SimdLevel::SSE4: return detail::negateSse4(c, a.size());
+#endif
+        default: return detail::negateScalar(c, 0, a.size());
+        }
+    }
+
+    FRACLIB_INLINE std::size_t batchReciprocal(const FractionArray& a, FractionArray& result, OverflowMask& overflow) {
+        detail::BatchColumns c = detail::prepareBatch(a, nullptr, result, &overflow);
+        switch (activeSimdLevel()) {
+#ifdef FRACLIB_X86_SIMD
+        case SimdLevel::AVX2: return detail::reciprocalAvx2(c, a.size());
+        case SimdLevel::SSE4: return detail::reciprocalSse4(c, a.size());
+#endif
+        default: return detail::reciprocalScalar(c, 0, a.size());
+        }
+    }
+
+    FRACLIB_INLINE std::size_t batchFromDouble(const double* values, std::size_t count, FractionArray& result, OverflowMask& overflow) {
+        result.resize(count);
+        overflow.resize(count);
+        std::int32_t* rn = result.numerators();
+        std::int32_t* rd = result.denominators();
+        std::size_t flagged = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            // Same conversion as Fraction32's, without the exceptions
+            bool bad = !detail::nearestDouble(values[i], rn[i], rd[i]);
+            if (bad) {
+                rn[i] = 0;
+                rd[i] = 1;
+            }
+            overflow[i] = static_cast<std::uint8_t>(bad);
+            flagged += bad;
+        }
+        return flagged;
+    }
+
+    FRACLIB_INLINE std::size_t batchLimitDenominator(const double* values, std::size_t count, std::int32_t maxDenominator, FractionArray& result, OverflowMask& overflow) {
+        if (maxDenominator < 1) {
+            detail::throwError(std::invalid_argument(Fraction32::MAX_DENOMINATOR_ERROR));
+        }
+        result.resize(count);
+        overflow.resize(count);
+        std::int32_t* rn = result.numerators();
+        std::int32_t* rd = result.denominators();
+        std::size_t flagged = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            bool bad = !detail::limitDouble(values[i], static_cast<std::uint32_t>(maxDenominator), rn[i], rd[i]);
+            if (bad) {
+                rn[i] = 0;
+                rd[i] = 1;
+            }
+            overflow[i] = static_cast<std::uint8_t>(bad);
+            flagged += bad;
+        }
+        return flagged;
+    }
+
+    FRACLIB_INLINE void batchCompare(const FractionArray& a, const FractionArray& b, std::vector<std::int8_t>& order) {
+        if (b.size() != a.size()) {
+            detail::throwError(std::invalid_argument("FractionArray sizes must match."));
+        }
+        order.resize(a.size());
+        detail::BatchColumns c{a.numerators(), a.denominators(), b.numerators(), b.denominators(), nullptr, nullptr, nullptr};
+        switch (activeSimdLevel()) {
+#ifdef FRACLIB_X86_SIMD
+        case SimdLevel::AVX2: detail::compareAvx2(c, order.data(), a.size()); break;
+        case SimdLevel::SSE4: detail::compareSse4(c, order.data(), a.size()); break;
+#endif
+        default: detail::compareScalar(c, order.data(), 0, a.size()); break;
+        }
+    }
+}
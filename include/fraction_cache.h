@@ -0,0 +1,415 @@
+/**************************************************************************/
+/*  fraction_cache.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "fraction.h"
+
+namespace FracLib {
+    /// @brief Lookups of one FractionParseCache, summed over every thread since it was created
+    /// or last reset. Threads still parsing may be mid-update, so a snapshot taken under load
+    /// is only consistent per field.
+    struct ParseCacheStats {
+        /// @brief Strings found in the calling thread's front cache.
+        std::uint64_t frontHits = 0;
+        /// @brief Strings found in the shared table (and copied to the front cache).
+        std::uint64_t sharedHits = 0;
+        /// @brief Strings found in neither and parsed, including the ones that failed to parse.
+        std::uint64_t misses = 0;
+        /// @brief Strings longer than `MAX_KEY_LENGTH`, parsed without the cache.
+        std::uint64_t uncached = 0;
+        /// @brief Parsed values added to the shared table.
+        std::uint64_t insertions = 0;
+        /// @brief Shared entries replaced to make room.
+        std::uint64_t evictions = 0;
+
+        std::uint64_t hits() const noexcept { return frontHits + sharedHits; }
+        std::uint64_t lookups() const noexcept { return hits() + misses + uncached; }
+        /// @brief Share of the lookups answered without parsing.
+        double hitRate() const noexcept {
+            std::uint64_t total = lookups();
+            return total == 0 ? 0.0 : static_cast<double>(hits()) / static_cast<double>(total);
+        }
+    };
+
+    namespace detail {
+        /// @brief A process-wide unique, nonzero tag. Front cache entries carry the tag of the
+        /// cache (and clear) they were filled under, so entries of another cache or from
+        /// before a clear never match.
+        inline std::uint64_t nextParseCacheEpoch() noexcept {
+            static std::atomic<std::uint64_t> epoch{0};
+            return epoch.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+
+        /// @brief A process-wide index of the calling thread, starting at 0 and never reused.
+        inline std::size_t parseCacheThread() noexcept {
+            static std::atomic<std::size_t> next{0};
+            static thread_local std::size_t index = 0; // 1 + the index once assigned
+            if (index == 0) index = next.fetch_add(1, std::memory_order_relaxed) + 1;
+            return index - 1;
+        }
+    }
+
+    /// @brief Interning cache for text that repeats: parsed fractions keyed by their exact
+    /// bytes (and the simplify flag), so a string seen before costs one hash and a copy
+    /// instead of a parse. Two levels share that hash:
+    /// - a per-thread, direct-mapped front cache of `FRONT_SIZE` entries, touched by no other thread;
+    /// - a bounded, 4-way set-associative table shared by all threads. Readers never lock or
+    ///   write to it: one word of 16-bit hash tags per set picks the slots worth comparing, each
+    ///   slot is a sequence lock, and a reader that overlaps a writer simply misses. Writers
+    ///   claim a slot with one compare-and-swap and give up if it is taken.
+    ///
+    /// Results are identical to `FractionT::tryParse` and the `std::string_view` constructor.
+    /// Strings that fail to parse are not cached, and strings longer than `MAX_KEY_LENGTH`
+    /// bypass it.
+    /// Thread-safe, including `clear`. For built-in storage types.
+    /// @example FractionParseCache<Fraction64> cache; Fraction64 price = cache.parse(field);
+    template <typename FractionT = Fraction>
+    class FractionParseCache {
+        static_assert(FractionT::traits_type::is_bounded, "FractionParseCache supports built-in storage types only.");
+        static_assert(std::is_trivially_copyable<FractionT>::value, "FractionParseCache copies fractions as bytes.");
+
+    public:
+        using fraction_type = FractionT;
+
+        /// @brief Longest string cached: keys are the length, the simplify flag and the bytes,
+        /// packed in 32 bytes.
+        static constexpr std::size_t MAX_KEY_LENGTH = 31;
+        /// @brief Entries in each thread's front cache (per fraction type).
+        static constexpr std::size_t FRONT_SIZE = 256;
+        /// @brief Entries a string can occupy in the shared table.
+        static constexpr std::size_t WAYS = 4;
+
+    public: // CONSTRUCTORS
+        /// @brief A shared table of at least `capacity` entries, rounded up to a power of two.
+        explicit FractionParseCache(std::size_t capacity = 4096);
+        FractionParseCache(const FractionParseCache&) = delete;
+        FractionParseCache& operator=(const FractionParseCache&) = delete;
+
+    public: // METHODS
+        /// @brief `FractionT::tryParse(text, simplify)`, from the cache when `text` was seen before.
+        FractionResult<FractionT> tryParse(std::string_view text, bool simplify = false) noexcept;
+        /// @brief `FractionT(text, simplify)`, from the cache when `text` was seen before.
+        /// @throws std::invalid_argument If the string is not a fraction or has a zero denominator.
+        /// @throws std::overflow_error If a component does not fit.
+        FractionT parse(std::string_view text, bool simplify = false);
+        /// @brief Drops every entry, including the ones in each thread's front cache.
+        void clear() noexcept;
+        /// @brief Entries in the shared table.
+        std::size_t capacity() const noexcept { return slots_.size(); }
+        ParseCacheStats stats() const noexcept;
+        /// @brief Starts the counts again from zero.
+        void resetStats() noexcept;
+
+    private:
+        static constexpr std::size_t KEY_WORDS = 4;
+        static constexpr std::size_t VALUE_WORDS = (sizeof(FractionT) + 7) / 8;
+        // One counter block per thread for the first STAT_SHARDS - 1 threads, which count with a
+        // plain load and store; later threads share the last block and count atomically
+        static constexpr std::size_t STAT_SHARDS = 32;
+
+        /// @brief The packed key and its hash.
+        struct Key {
+            std::uint64_t words[KEY_WORDS];
+            std::uint64_t hash;
+        };
+        /// @brief A shared entry. `sequence` is odd while a writer owns the slot; readers check
+        /// it is unchanged after copying. Every field is atomic, so those copies are not races.
+        struct alignas(64) Slot {
+            std::atomic<std::uint64_t> sequence;
+            std::atomic<std::uint64_t> key[KEY_WORDS];
+            std::atomic<std::uint64_t> value[VALUE_WORDS];
+        };
+        /// @brief A front cache entry, valid while `epoch` is the owning cache's.
+        struct FrontEntry {
+            std::uint64_t epoch;
+            std::uint64_t key[KEY_WORDS];
+            std::uint64_t value[VALUE_WORDS];
+        };
+        struct alignas(64) StatShard {
+            std::atomic<std::uint64_t> frontHits;
+            std::atomic<std::uint64_t> sharedHits;
+            std::atomic<std::uint64_t> misses;
+            std::atomic<std::uint64_t> uncached;
+            std::atomic<std::uint64_t> insertions;
+            std::atomic<std::uint64_t> evictions;
+        };
+
+        static Key makeKey(std::string_view text, bool simplify) noexcept;
+        static bool sameKey(const std::uint64_t* a, const std::uint64_t* b) noexcept;
+        static bool sameKey(const Slot& slot, const Key& key) noexcept;
+        /// @brief The calling thread's front cache. Trivial, so it needs no initialization guard.
+        static FrontEntry* frontCache() noexcept {
+            static thread_local FrontEntry entries[FRONT_SIZE];
+            return entries;
+        }
+        static FractionT fromWords(const std::uint64_t* words) noexcept;
+        static void toWords(const FractionT& value, std::uint64_t* words) noexcept;
+
+        std::size_t setOf(const Key& key) const noexcept { return static_cast<std::size_t>(key.hash >> 32) & (tags_.size() - 1); }
+        /// @brief The key's tag in its set's tag word; never 0, which marks an empty way.
+        static std::uint64_t tagOf(const Key& key) noexcept { return ((key.hash >> 16) & 0xFFFF) | 1; }
+        bool findShared(const Key& key, std::uint64_t* value) noexcept;
+        void insertShared(const Key& key, const std::uint64_t* value) noexcept;
+        void count(std::atomic<std::uint64_t> StatShard::*counter) noexcept;
+
+        std::vector<Slot> slots_;
+        // Per set, the tag of each way's key in 16 bits (way 0 lowest). Only a hint: a slot is
+        // used only if its full key matches, so a stale tag costs a comparison, not a wrong value
+        std::vector<std::atomic<std::uint64_t>> tags_;
+        std::atomic<std::uint64_t> epoch_;
+        StatShard stats_[STAT_SHARDS] = {};
+    };
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    FractionParseCache<FractionT>::FractionParseCache(std::size_t capacity)
+        : epoch_(detail::nextParseCacheEpoch()) {
+        std::size_t size = WAYS;
+        while (size < capacity) size *= 2;
+        slots_ = std::vector<Slot>(size);
+        tags_ = std::vector<std::atomic<std::uint64_t>>(size / WAYS);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    FractionResult<FractionT> FractionParseCache<FractionT>::tryParse(std::string_view text, bool simplify) noexcept {
+        if (text.size() > MAX_KEY_LENGTH) {
+            count(&StatShard::uncached);
+            return FractionT::tryParse(text, simplify);
+        }
+        const Key key = makeKey(text, simplify);
+        const std::uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+        FrontEntry& front = frontCache()[key.hash & (FRONT_SIZE - 1)];
+        if (front.epoch == epoch && sameKey(front.key, key.words)) {
+            count(&StatShard::frontHits);
+            return fromWords(front.value);
+        }
+
+        std::uint64_t value[VALUE_WORDS];
+        if (findShared(key, value)) {
+            count(&StatShard::sharedHits);
+        } else {
+            count(&StatShard::misses);
+            FractionResult<FractionT> result = FractionT::tryParse(text, simplify);
+            if (!result) return result;
+            toWords(*result, value);
+            insertShared(key, value);
+        }
+        front.epoch = epoch;
+        std::memcpy(front.key, key.words, sizeof(front.key));
+        std::memcpy(front.value, value, sizeof(front.value));
+        return fromWords(value);
+    }
+
+    template <typename FractionT>
+    FractionT FractionParseCache<FractionT>::parse(std::string_view text, bool simplify) {
+        FractionResult<FractionT> result = tryParse(text, simplify);
+        if (!result) return FractionT(text, simplify); // Throws the constructor's exception
+        return *result;
+    }
+
+    template <typename FractionT>
+    void FractionParseCache<FractionT>::clear() noexcept {
+        // Lookups only compare slots whose way is tagged, so untagging drops the entries
+        epoch_.store(detail::nextParseCacheEpoch(), std::memory_order_relaxed);
+        for (std::atomic<std::uint64_t>& tags : tags_) tags.store(0, std::memory_order_relaxed);
+    }
+
+    template <typename FractionT>
+    ParseCacheStats FractionParseCache<FractionT>::stats() const noexcept {
+        ParseCacheStats total;
+        for (const StatShard& counters : stats_) {
+            total.frontHits += counters.frontHits.load(std::memory_order_relaxed);
+            total.sharedHits += counters.sharedHits.load(std::memory_order_relaxed);
+            total.misses += counters.misses.load(std::memory_order_relaxed);
+            total.uncached += counters.uncached.load(std::memory_order_relaxed);
+            total.insertions += counters.insertions.load(std::memory_order_relaxed);
+            total.evictions += counters.evictions.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    template <typename FractionT>
+    void FractionParseCache<FractionT>::resetStats() noexcept {
+        for (StatShard& counters : stats_) {
+            counters.frontHits.store(0, std::memory_order_relaxed);
+            counters.sharedHits.store(0, std::memory_order_relaxed);
+            counters.misses.store(0, std::memory_order_relaxed);
+            counters.uncached.store(0, std::memory_order_relaxed);
+            counters.insertions.store(0, std::memory_order_relaxed);
+            counters.evictions.store(0, std::memory_order_relaxed);
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Private Functions
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    void FractionParseCache<FractionT>::count(std::atomic<std::uint64_t> StatShard::*counter) noexcept {
+        const std::size_t thread = detail::parseCacheThread();
+        if (thread < STAT_SHARDS - 1) {
+            std::atomic<std::uint64_t>& value = stats_[thread].*counter;
+            value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            (stats_[STAT_SHARDS - 1].*counter).fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename FractionT>
+    typename FractionParseCache<FractionT>::Key FractionParseCache<FractionT>::makeKey(std::string_view text, bool simplify) noexcept {
+        // Loaded a word at a time in native byte order. The encoding only has to be one-to-one
+        // for a given length, so a 4 to 7 byte tail is two overlapping 4-byte loads side by
+        // side. The last word keeps its top byte for the header and takes its bytes one by one.
+        const char* bytes = text.data();
+        const std::size_t size = text.size();
+        Key key = {};
+        std::size_t word = 0;
+        for (; word < KEY_WORDS - 1 && word * 8 + 8 <= size; ++word) std::memcpy(&key.words[word], bytes + word * 8, 8);
+        const std::size_t at = word * 8;
+        const std::size_t rest = size - at;
+        if (word == KEY_WORDS - 1) {
+            for (std::size_t i = 0; i < rest; ++i) key.words[word] |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[at + i])) << (i * 8);
+        } else if (rest >= 4) {
+            std::uint32_t low = 0, high = 0;
+            std::memcpy(&low, bytes + at, 4);
+            std::memcpy(&high, bytes + at + rest - 4, 4);
+            key.words[word] = low | static_cast<std::uint64_t>(high) << 32;
+        } else if (rest > 0) {
+            auto byteAt = [&](std::size_t i) { return static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[at + i])); };
+            key.words[word] = byteAt(0) | byteAt(rest / 2) << 8 | byteAt(rest - 1) << 16;
+        }
+        // The last byte holds the length and the simplify flag, with a bit that is always set
+        key.words[KEY_WORDS - 1] |= static_cast<std::uint64_t>(0x20 | (simplify ? 0x40 : 0) | size) << 56;
+
+        // Multiply-xorshift per word and a final avalanche, so both the low bits (front
+        // cache) and the high bits (shared set) depend on every byte
+        std::uint64_t hash = 0x9E3779B97F4A7C15ull;
+        for (std::uint64_t value : key.words) {
+            hash = (hash ^ value) * 0xBF58476D1CE4E5B9ull;
+            hash ^= hash >> 31;
+        }
+        hash *= 0x94D049BB133111EBull;
+        key.hash = hash ^ (hash >> 29);
+        return key;
+    }
+
+    template <typename FractionT>
+    bool FractionParseCache<FractionT>::sameKey(const std::uint64_t* a, const std::uint64_t* b) noexcept {
+        return ((a[0] ^ b[0]) | (a[1] ^ b[1]) | (a[2] ^ b[2]) | (a[3] ^ b[3])) == 0;
+    }
+
+    template <typename FractionT>
+    bool FractionParseCache<FractionT>::sameKey(const Slot& slot, const Key& key) noexcept {
+        std::uint64_t difference = 0;
+        for (std::size_t i = 0; i < KEY_WORDS; ++i) difference |= slot.key[i].load(std::memory_order_relaxed) ^ key.words[i];
+        return difference == 0;
+    }
+
+    template <typename FractionT>
+    FractionT FractionParseCache<FractionT>::fromWords(const std::uint64_t* words) noexcept {
+        FractionT value;
+        std::memcpy(static_cast<void*>(&value), words, sizeof(FractionT));
+        return value;
+    }
+
+    template <typename FractionT>
+    void FractionParseCache<FractionT>::toWords(const FractionT& value, std::uint64_t* words) noexcept {
+        words[VALUE_WORDS - 1] = 0;
+        std::memcpy(words, static_cast<const void*>(&value), sizeof(FractionT));
+    }
+
+    template <typename FractionT>
+    bool FractionParseCache<FractionT>::findShared(const Key& key, std::uint64_t* value) noexcept {
+        const std::size_t set = setOf(key);
+        const std::uint64_t tags = tags_[set].load(std::memory_order_relaxed);
+        const std::uint64_t tag = tagOf(key);
+        for (std::size_t way = 0; way < WAYS; ++way) {
+            if (((tags >> (way * 16)) & 0xFFFF) != tag) continue;
+            Slot& slot = slots_[set * WAYS + way];
+            const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0) continue;
+            if (!sameKey(slot, key)) continue;
+            for (std::size_t i = 0; i < VALUE_WORDS; ++i) value[i] = slot.value[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == sequence) return true;
+        }
+        return false;
+    }
+
+    template <typename FractionT>
+    void FractionParseCache<FractionT>::insertShared(const Key& key, const std::uint64_t* value) noexcept {
+        const std::size_t set = setOf(key);
+        std::atomic<std::uint64_t>& tagWord = tags_[set];
+        std::uint64_t tags = tagWord.load(std::memory_order_relaxed);
+        const std::uint64_t tag = tagOf(key);
+        std::size_t target = WAYS;
+        for (std::size_t way = 0; way < WAYS; ++way) {
+            const std::uint64_t wayTag = (tags >> (way * 16)) & 0xFFFF;
+            if (wayTag == tag && sameKey(slots_[set * WAYS + way], key)) return; // Another thread got there first
+            if (wayTag == 0 && target == WAYS) target = way;
+        }
+        if (target == WAYS) {
+            // Full set: replace a way picked by a per-thread clock, so two strings that keep
+            // missing do not always evict each other
+            static thread_local std::size_t clock = 0;
+            target = (static_cast<std::size_t>(key.hash >> 60) + clock++) & (WAYS - 1);
+        }
+
+        Slot& slot = slots_[set * WAYS + target];
+        std::uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1) != 0 || !slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return; // Another writer owns the slot; this value is simply not cached
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < KEY_WORDS; ++i) slot.key[i].store(key.words[i], std::memory_order_relaxed);
+        for (std::size_t i = 0; i < VALUE_WORDS; ++i) slot.value[i].store(value[i], std::memory_order_relaxed);
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+
+        const std::uint64_t shift = target * 16;
+        std::uint64_t desired;
+        do {
+            desired = (tags & ~(std::uint64_t(0xFFFF) << shift)) | tag << shift;
+        } while (!tagWord.compare_exchange_weak(tags, desired, std::memory_order_relaxed));
+        count(&StatShard::insertions);
+        if (((tags >> shift) & 0xFFFF) != 0) count(&StatShard::evictions);
+    }
+}
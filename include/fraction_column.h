@@ -0,0 +1,611 @@
+/**************************************************************************/
+/*  fraction_column.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "fraction.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+
+namespace FracLib {
+    namespace detail {
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Column Encoding
+        //\\\\\\\\\\\\\\\\\\\\/
+        // A fraction column file, all integers little-endian:
+        //   header  "FRACCOL1", uint32 bits per component, uint32 flags
+        //   blocks  `blockSize` values each (the last may be shorter), decodable on their own
+        //   index   uint64 file offset of every block
+        //   footer  uint64 index offset, uint64 value count, uint32 block size,
+        //           uint32 block count, "FRACEND1"
+        // A block holds its numerators, then its denominators:
+        //   uint8 0, zigzag varint per numerator          or  uint8 1, uint8 width, bit-packed zigzag
+        //   uint8 0, zigzag varint delta per denominator  or  uint8 1, uint8 entries - 1, zigzag
+        //                                                     varint per entry, bit-packed indices
+        // Each block picks whichever encoding is smaller.
+        inline constexpr char columnMagic[8] = {'F', 'R', 'A', 'C', 'C', 'O', 'L', '1'};
+        inline constexpr char columnEndMagic[8] = {'F', 'R', 'A', 'C', 'E', 'N', 'D', '1'};
+        inline constexpr std::size_t columnHeaderSize = 16;
+        inline constexpr std::size_t columnFooterSize = 32;
+        /// @brief Header flag: every value was in lowest terms with a positive denominator.
+        inline constexpr std::uint32_t columnCanonical = 1;
+        /// @brief Most distinct denominators a dictionary-encoded block can hold.
+        inline constexpr std::size_t columnDictionaryLimit = 256;
+
+        template <typename T>
+        void putLittle(std::string& out, T value) {
+            for (std::size_t i = 0; i < sizeof(T); ++i) out.push_back(static_cast<char>(static_cast<std::uint64_t>(value) >> (8 * i)));
+        }
+        template <typename T>
+        T getLittle(const unsigned char* p) noexcept {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i) value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+            return static_cast<T>(value);
+        }
+
+        template <typename IntT>
+        constexpr UnsignedOfT<IntT> zigzag(IntT value) noexcept {
+            using U = UnsignedOfT<IntT>;
+            return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value < 0 ? ~U(0) : U(0)));
+        }
+        template <typename IntT>
+        constexpr IntT unzigzag(UnsignedOfT<IntT> value) noexcept {
+            using U = UnsignedOfT<IntT>;
+            return static_cast<IntT>(static_cast<U>(value >> 1) ^ static_cast<U>(U(0) - static_cast<U>(value & 1)));
+        }
+
+        template <typename U>
+        constexpr std::size_t varintSize(U value) noexcept {
+            return value == 0 ? 1 : static_cast<std::size_t>(bitWidth(value) + 6) / 7;
+        }
+        template <typename U>
+        void putVarint(std::string& out, U value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<char>(static_cast<unsigned>(value & 0x7F) | 0x80));
+                value = static_cast<U>(value >> 7);
+            }
+            out.push_back(static_cast<char>(value));
+        }
+        /// @brief Reads a LEB128 varint, failing on truncated input or values wider than U.
+        template <typename U>
+        bool getVarint(const unsigned char*& p, const unsigned char* end, U& value) noexcept {
+            value = 0;
+            for (unsigned shift = 0; p != end; shift += 7) {
+                unsigned byte = *p++;
+                unsigned room = static_cast<unsigned>(sizeof(U) * 8) - std::min(shift, static_cast<unsigned>(sizeof(U) * 8));
+                if (room == 0 || (room < 7 && (byte & 0x7F) >> room != 0)) return false;
+                value = static_cast<U>(value | static_cast<U>(static_cast<U>(byte & 0x7F) << shift));
+                if ((byte & 0x80) == 0) return true;
+            }
+            return false;
+        }
+
+        /// @brief Appends values of up to 128 bits, least significant bit first.
+        class BitWriter {
+        public:
+            explicit BitWriter(std::string& out) : out_(out) {}
+            template <typename U>
+            void put(U value, unsigned width) {
+                for (unsigned done = 0; done < width; done += 32) {
+                    unsigned take = std::min(32u, width - done);
+                    auto part = static_cast<std::uint64_t>(static_cast<U>(value >> done)) & ((std::uint64_t(1) << take) - 1);
+                    pending_ |= part << bits_;
+                    bits_ += take;
+                    while (bits_ >= 8) {
+                        out_.push_back(static_cast<char>(pending_));
+                        pending_ >>= 8;
+                        bits_ -= 8;
+                    }
+                }
+            }
+            /// @brief Pads the last byte with zeros.
+            void flush() {
+                if (bits_ > 0) out_.push_back(static_cast<char>(pending_));
+                pending_ = 0;
+                bits_ = 0;
+            }
+
+        private:
+            std::string& out_;
+            std::uint64_t pending_ = 0;
+            unsigned bits_ = 0;
+        };
+
+        /// @brief Reads what BitWriter wrote; the caller checks the byte range beforehand.
+        class BitReader {
+        public:
+            /// @param position The bit to start reading at.
+            explicit BitReader(const unsigned char* data, std::size_t position = 0) noexcept : data_(data), position_(position) {}
+            template <typename U>
+            U get(unsigned width) noexcept {
+                U value = 0;
+                for (unsigned done = 0; done < width; done += 32) {
+                    unsigned take = std::min(32u, width - done);
+                    std::size_t byte = position_ >> 3;
+                    unsigned shift = static_cast<unsigned>(position_ & 7);
+                    // At most 39 bits starting in this byte: five bytes
+                    std::uint64_t window = 0;
+                    unsigned needed = (shift + take + 7) / 8;
+                    for (unsigned i = 0; i < needed; ++i) window |= static_cast<std::uint64_t>(data_[byte + i]) << (8 * i);
+                    auto part = (window >> shift) & ((std::uint64_t(1) << take) - 1);
+                    value = static_cast<U>(value | static_cast<U>(static_cast<U>(part) << done));
+                    position_ += take;
+                }
+                return value;
+            }
+            static constexpr std::size_t bytesFor(std::size_t count, unsigned width) noexcept { return (count * width + 7) / 8; }
+
+        private:
+            const unsigned char* data_;
+            std::size_t position_;
+        };
+
+        /// @brief Encodes `count` fractions as one block, appending to `out`. `scratch` is reused
+        /// between blocks for the dictionary.
+        template <typename FractionT>
+        void encodeColumnBlock(const FractionT* values, std::size_t count, std::string& out, std::vector<UnsignedOfT<typename FractionT::value_type>>& scratch) {
+            using IntT = typename FractionT::value_type;
+            using U = UnsignedOfT<IntT>;
+
+            // Numerators: varints unless packing at the widest one's width is smaller
+            std::size_t varintBytes = 0;
+            U widest = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                U z = zigzag<IntT>(values[i].numerator);
+                varintBytes += varintSize(z);
+                widest = static_cast<U>(widest | z);
+            }
+            unsigned width = static_cast<unsigned>(bitWidth(widest));
+            if (1 + BitReader::bytesFor(count, width) < varintBytes) {
+                out.push_back(1);
+                out.push_back(static_cast<char>(width));
+                BitWriter bits(out);
+                for (std::size_t i = 0; i < count; ++i) bits.put(zigzag<IntT>(values[i].numerator), width);
+                bits.flush();
+            } else {
+                out.push_back(0);
+                for (std::size_t i = 0; i < count; ++i) putVarint(out, zigzag<IntT>(values[i].numerator));
+            }
+
+            // Denominators: deltas, or indices into the block's distinct values when there are few
+            std::size_t deltaBytes = 0;
+            U previous = 0;
+            scratch.clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                U d = static_cast<U>(values[i].denominator);
+                deltaBytes += varintSize(zigzag<IntT>(static_cast<IntT>(static_cast<U>(d - previous))));
+                previous = d;
+                scratch.push_back(d);
+            }
+            std::sort(scratch.begin(), scratch.end());
+            scratch.erase(std::unique(scratch.begin(), scratch.end()), scratch.end());
+            std::size_t dictionaryBytes = deltaBytes;
+            unsigned indexWidth = 0;
+            if (!scratch.empty() && scratch.size() <= columnDictionaryLimit) {
+                indexWidth = static_cast<unsigned>(bitWidth(scratch.size() - 1));
+                dictionaryBytes = 1 + BitReader::bytesFor(count, indexWidth);
+                for (U entry : scratch) dictionaryBytes += varintSize(zigzag<IntT>(static_cast<IntT>(entry)));
+            }
+            if (dictionaryBytes < deltaBytes) {
+                out.push_back(1);
+                out.push_back(static_cast<char>(scratch.size() - 1));
+                for (U entry : scratch) putVarint(out, zigzag<IntT>(static_cast<IntT>(entry)));
+                BitWriter bits(out);
+                for (std::size_t i = 0; i < count; ++i) {
+                    U d = static_cast<U>(values[i].denominator);
+                    bits.put(static_cast<U>(std::lower_bound(scratch.begin(), scratch.end(), d) - scratch.begin()), indexWidth);
+                }
+                bits.flush();
+            } else {
+                out.push_back(0);
+                previous = 0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    U d = static_cast<U>(values[i].denominator);
+                    putVarint(out, zigzag<IntT>(static_cast<IntT>(static_cast<U>(d - previous))));
+                    previous = d;
+                }
+            }
+        }
+    }
+
+    /// @brief Writes fractions to a stream in the compact binary column format read by
+    /// FractionColumnReader. Values are buffered into blocks of `blockSize`; each block stores
+    /// its numerators as zigzag varints or bit-packed, and its denominators as varint deltas
+    /// or as indices into a dictionary of the block's distinct denominators, whichever is
+    /// smaller. `finish()` writes the last block and the block index.
+    /// @example FractionColumnWriter<Fraction64> writer(file); writer.write(values.data(), values.size()); writer.finish();
+    template <typename FractionT>
+    class FractionColumnWriter {
+        static_assert(FractionT::traits_type::is_bounded, "Fraction columns store built-in integer components.");
+    public:
+        using fraction_type = FractionT;
+        static constexpr std::size_t DEFAULT_BLOCK_SIZE = 4096;
+        static constexpr const char* WRITE_ERROR = "Cannot write the fraction column.";
+        static constexpr const char* FINISHED_ERROR = "The fraction column is already finished.";
+
+    public: // CONSTRUCTORS
+        /// @brief Writes the header to `out`.
+        /// @throws std::invalid_argument If `blockSize` is 0.
+        /// @throws std::runtime_error If the stream fails.
+        explicit FractionColumnWriter(std::ostream& out, std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    public: // METHODS
+        void write(const FractionT& value);
+        void write(const FractionT* values, std::size_t count);
+        /// @brief Writes the last block, the index and the footer. Nothing can be written after.
+        void finish();
+        /// @brief Values written so far.
+        std::size_t size() const noexcept { return count_; }
+
+    private:
+        using unsigned_type = detail::UnsignedOfT<typename FractionT::value_type>;
+        void writeBlock();
+        void emit(const std::string& bytes);
+
+        std::ostream& out_;
+        std::size_t blockSize_;
+        std::size_t count_ = 0;
+        std::uint64_t offset_ = 0;
+        std::vector<FractionT> pending_;
+        std::vector<std::uint64_t> index_;
+        std::string buffer_;
+        std::vector<unsigned_type> scratch_;
+        bool finished_ = false;
+    };
+
+    /// @brief Reads a fraction column file. The file is memory-mapped and blocks are decoded on
+    /// demand straight into the caller's buffer; the block index makes any range reachable
+    /// without decoding the blocks before it. The column must be read with the storage width
+    /// it was written with. A column written from a normalized type is read back into one
+    /// without reducing again.
+    /// @example FractionColumnReader<Fraction64> column("values.frc"); std::vector<Fraction64> all = column.readAll();
+    template <typename FractionT>
+    class FractionColumnReader {
+        static_assert(FractionT::traits_type::is_bounded, "Fraction columns store built-in integer components.");
+    public:
+        using fraction_type = FractionT;
+        static constexpr const char* CORRUPT_ERROR = "Not a valid fraction column.";
+        static constexpr const char* WIDTH_ERROR = "The fraction column was written with a different integer width.";
+        static constexpr const char* RANGE_ERROR = "Fraction column index out of range.";
+
+    public: // CONSTRUCTORS
+        /// @brief Maps and validates `path`.
+        /// @throws std::system_error If the file cannot be opened or mapped.
+        /// @throws std::runtime_error If it is not a fraction column of this width.
+        explicit FractionColumnReader(const std::string& path);
+        /// @brief Reads a column already in memory; `data` must outlive the reader.
+        FractionColumnReader(const char* data, std::size_t size);
+
+    public: // METHODS
+        std::size_t size() const noexcept { return count_; }
+        std::size_t blockSize() const noexcept { return blockSize_; }
+        std::size_t blockCount() const noexcept { return blockCount_; }
+        /// @brief Decodes block `block` into `out`, which has room for `blockSize()` values.
+        /// @return The number of values in the block.
+        /// @throws std::out_of_range If there is no such block.
+        /// @throws std::runtime_error If the block is corrupt.
+        std::size_t readBlock(std::size_t block, FractionT* out) const;
+        /// @brief Decodes values [first, first + count) into `out`, touching only their blocks.
+        /// @throws std::out_of_range If the range extends past the end.
+        void read(std::size_t first, std::size_t count, FractionT* out) const;
+        /// @brief The value at `position` (decodes its block).
+        FractionT at(std::size_t position) const;
+        /// @brief Every value, with the blocks decoded in parallel on `pool` (nullptr uses
+        /// ThreadPool::shared()).
+        std::vector<FractionT> readAll(ThreadPool* pool = nullptr) const;
+
+    private:
+        using value_type = typename FractionT::value_type;
+        using unsigned_type = detail::UnsignedOfT<value_type>;
+        void open();
+        /// @brief Decodes the values [begin, end) of `block` into out[0, end - begin).
+        void decodeBlock(std::size_t block, std::size_t begin, std::size_t end, FractionT* out) const;
+        [[noreturn]] static void corrupt() { detail::throwError(std::runtime_error(CORRUPT_ERROR)); }
+
+        MappedFile file_;
+        const unsigned char* data_ = nullptr;
+        std::size_t bytes_ = 0;
+        std::size_t count_ = 0;
+        std::size_t blockSize_ = 0;
+        std::size_t blockCount_ = 0;
+        std::size_t indexOffset_ = 0;
+        bool canonical_ = false;
+    };
+
+    /// @brief Writes `count` values to `path` as a fraction column.
+    /// @throws std::system_error If the file cannot be created.
+    /// @throws std::runtime_error If writing fails.
+    template <typename FractionT>
+    void writeFractionColumn(const std::string& path, const FractionT* values, std::size_t count, std::size_t blockSize = FractionColumnWriter<FractionT>::DEFAULT_BLOCK_SIZE) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            detail::throwError(std::system_error(errno, std::generic_category(), "Cannot create " + path));
+        }
+        FractionColumnWriter<FractionT> writer(file, blockSize);
+        writer.write(values, count);
+        writer.finish();
+        file.close();
+        if (!file) {
+            detail::throwError(std::runtime_error(FractionColumnWriter<FractionT>::WRITE_ERROR));
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Writer
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    FractionColumnWriter<FractionT>::FractionColumnWriter(std::ostream& out, std::size_t blockSize) : out_(out), blockSize_(blockSize) {
+        if (blockSize_ == 0 || blockSize_ > UINT32_MAX) {
+            detail::throwError(std::invalid_argument("The block size must be between 1 and 2^32 - 1."));
+        }
+        pending_.reserve(blockSize_);
+        std::string header(detail::columnMagic, sizeof(detail::columnMagic));
+        detail::putLittle(header, static_cast<std::uint32_t>(sizeof(typename FractionT::value_type) * 8));
+        detail::putLittle(header, FractionT::is_normalized ? detail::columnCanonical : std::uint32_t(0));
+        emit(header);
+    }
+
+    template <typename FractionT>
+    void FractionColumnWriter<FractionT>::write(const FractionT& value) {
+        if (finished_) {
+            detail::throwError(std::logic_error(FINISHED_ERROR));
+        }
+        pending_.push_back(value);
+        ++count_;
+        if (pending_.size() == blockSize_) writeBlock();
+    }
+
+    template <typename FractionT>
+    void FractionColumnWriter<FractionT>::write(const FractionT* values, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) write(values[i]);
+    }
+
+    template <typename FractionT>
+    void FractionColumnWriter<FractionT>::finish() {
+        if (finished_) {
+            detail::throwError(std::logic_error(FINISHED_ERROR));
+        }
+        if (!pending_.empty()) writeBlock();
+        finished_ = true;
+        std::string tail;
+        std::uint64_t indexOffset = offset_;
+        for (std::uint64_t offset : index_) detail::putLittle(tail, offset);
+        detail::putLittle(tail, indexOffset);
+        detail::putLittle(tail, static_cast<std::uint64_t>(count_));
+        detail::putLittle(tail, static_cast<std::uint32_t>(blockSize_));
+        detail::putLittle(tail, static_cast<std::uint32_t>(index_.size()));
+        tail.append(detail::columnEndMagic, sizeof(detail::columnEndMagic));
+        emit(tail);
+        out_.flush();
+        if (!out_) {
+            detail::throwError(std::runtime_error(WRITE_ERROR));
+        }
+    }
+
+    template <typename FractionT>
+    void FractionColumnWriter<FractionT>::writeBlock() {
+        buffer_.clear();
+        detail::encodeColumnBlock(pending_.data(), pending_.size(), buffer_, scratch_);
+        index_.push_back(offset_);
+        emit(buffer_);
+        pending_.clear();
+    }
+
+    template <typename FractionT>
+    void FractionColumnWriter<FractionT>::emit(const std::string& bytes) {
+        out_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        if (!out_) {
+            detail::throwError(std::runtime_error(WRITE_ERROR));
+        }
+        offset_ += bytes.size();
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Reader
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    FractionColumnReader<FractionT>::FractionColumnReader(const std::string& path) : file_(path) {
+        data_ = reinterpret_cast<const unsigned char*>(file_.data());
+        bytes_ = file_.size();
+        open();
+    }
+
+    template <typename FractionT>
+    FractionColumnReader<FractionT>::FractionColumnReader(const char* data, std::size_t size)
+        : data_(reinterpret_cast<const unsigned char*>(data)), bytes_(size) {
+        open();
+    }
+
+    template <typename FractionT>
+    void FractionColumnReader<FractionT>::open() {
+        if (bytes_ < detail::columnHeaderSize + detail::columnFooterSize
+            || std::memcmp(data_, detail::columnMagic, sizeof(detail::columnMagic)) != 0
+            || std::memcmp(data_ + bytes_ - sizeof(detail::columnEndMagic), detail::columnEndMagic, sizeof(detail::columnEndMagic)) != 0) {
+            corrupt();
+        }
+        if (detail::getLittle<std::uint32_t>(data_ + 8) != sizeof(value_type) * 8) {
+            detail::throwError(std::runtime_error(WIDTH_ERROR));
+        }
+        canonical_ = (detail::getLittle<std::uint32_t>(data_ + 12) & detail::columnCanonical) != 0;
+        const unsigned char* footer = data_ + bytes_ - detail::columnFooterSize;
+        std::uint64_t indexOffset = detail::getLittle<std::uint64_t>(footer);
+        std::uint64_t count = detail::getLittle<std::uint64_t>(footer + 8);
+        blockSize_ = detail::getLittle<std::uint32_t>(footer + 16);
+        blockCount_ = detail::getLittle<std::uint32_t>(footer + 20);
+        std::size_t indexEnd = bytes_ - detail::columnFooterSize;
+        if (blockSize_ == 0 || indexOffset < detail::columnHeaderSize || indexOffset > indexEnd
+            || (indexEnd - indexOffset) / 8 != blockCount_ || (indexEnd - indexOffset) % 8 != 0
+            || count > static_cast<std::uint64_t>(blockCount_) * blockSize_ || (blockCount_ > 0 && count <= static_cast<std::uint64_t>(blockCount_ - 1) * blockSize_)) {
+            corrupt();
+        }
+        indexOffset_ = static_cast<std::size_t>(indexOffset);
+        count_ = static_cast<std::size_t>(count);
+    }
+
+    template <typename FractionT>
+    std::size_t FractionColumnReader<FractionT>::readBlock(std::size_t block, FractionT* out) const {
+        if (block >= blockCount_) {
+            detail::throwError(std::out_of_range(RANGE_ERROR));
+        }
+        std::size_t values = std::min(blockSize_, count_ - block * blockSize_);
+        decodeBlock(block, 0, values, out);
+        return values;
+    }
+
+    template <typename FractionT>
+    void FractionColumnReader<FractionT>::read(std::size_t first, std::size_t count, FractionT* out) const {
+        if (first > count_ || count > count_ - first) {
+            detail::throwError(std::out_of_range(RANGE_ERROR));
+        }
+        while (count > 0) {
+            std::size_t block = first / blockSize_;
+            std::size_t begin = first % blockSize_;
+            std::size_t end = std::min(blockSize_, begin + count);
+            decodeBlock(block, begin, end, out);
+            out += end - begin;
+            first += end - begin;
+            count -= end - begin;
+        }
+    }
+
+    template <typename FractionT>
+    FractionT FractionColumnReader<FractionT>::at(std::size_t position) const {
+        FractionT value;
+        read(position, 1, &value);
+        return value;
+    }
+
+    template <typename FractionT>
+    std::vector<FractionT> FractionColumnReader<FractionT>::readAll(ThreadPool* pool) const {
+        std::vector<FractionT> values(count_);
+        FractionT* out = values.data();
+        (pool ? *pool : ThreadPool::shared()).parallelFor(blockCount_, [&](std::size_t block) { readBlock(block, out + block * blockSize_); });
+        return values;
+    }
+
+    template <typename FractionT>
+    void FractionColumnReader<FractionT>::decodeBlock(std::size_t block, std::size_t begin, std::size_t end, FractionT* out) const {
+        constexpr unsigned bits = sizeof(value_type) * 8;
+        const unsigned char* indexEntry = data_ + indexOffset_ + block * 8;
+        std::uint64_t start = detail::getLittle<std::uint64_t>(indexEntry);
+        std::uint64_t stop = block + 1 < blockCount_ ? detail::getLittle<std::uint64_t>(indexEntry + 8) : indexOffset_;
+        if (start < detail::columnHeaderSize || start > stop || stop > indexOffset_) corrupt();
+        const unsigned char* p = data_ + start;
+        const unsigned char* limit = data_ + stop;
+        std::size_t values = std::min(blockSize_, count_ - block * blockSize_);
+
+        // Numerators are parked in the output until the denominators are known. Bit-packed
+        // ones are read from `begin` directly; varints before and after the range are skipped.
+        auto skipVarints = [&](std::size_t n) {
+            // Eight bytes at a time while they cannot end past the last skipped varint
+            while (n >= 8 && limit - p >= 8) {
+                std::uint64_t word = detail::getLittle<std::uint64_t>(p);
+                auto ends = static_cast<std::size_t>(__builtin_popcountll(~word & 0x8080808080808080ull));
+                p += 8;
+                n -= ends;
+            }
+            for (; n > 0; --n) {
+                while (p != limit && (*p & 0x80) != 0) ++p;
+                if (p == limit) corrupt();
+                ++p;
+            }
+        };
+        if (p == limit) corrupt();
+        if (*p++ == 0) {
+            skipVarints(begin);
+            for (std::size_t i = begin; i < end; ++i) {
+                unsigned_type z = 0;
+                if (!detail::getVarint(p, limit, z)) corrupt();
+                out[i - begin].numerator = detail::unzigzag<value_type>(z);
+            }
+            skipVarints(values - end);
+        } else {
+            if (p == limit) corrupt();
+            unsigned width = *p++;
+            std::size_t packedBytes = detail::BitReader::bytesFor(values, width);
+            if (width > bits || static_cast<std::size_t>(limit - p) < packedBytes) corrupt();
+            detail::BitReader reader(p, begin * width);
+            for (std::size_t i = begin; i < end; ++i) {
+                out[i - begin].numerator = detail::unzigzag<value_type>(reader.template get<unsigned_type>(width));
+            }
+            p += packedBytes;
+        }
+
+        auto store = [&](std::size_t i, unsigned_type d) {
+            if (d == 0) corrupt();
+            FractionT& value = out[i - begin];
+            if (FractionT::is_normalized && canonical_) {
+                if (static_cast<value_type>(d) < 0) corrupt();
+                value.denominator = static_cast<value_type>(d);
+            } else {
+                value = FractionT(value.numerator, static_cast<value_type>(d));
+            }
+        };
+        if (p == limit) corrupt();
+        if (*p++ == 0) {
+            // Each delta depends on the one before, so decoding starts at the block's first value
+            unsigned_type previous = 0;
+            for (std::size_t i = 0; i < end; ++i) {
+                unsigned_type z = 0;
+                if (!detail::getVarint(p, limit, z)) corrupt();
+                previous = static_cast<unsigned_type>(previous + static_cast<unsigned_type>(detail::unzigzag<value_type>(z)));
+                if (i >= begin) store(i, previous);
+            }
+        } else {
+            if (p == limit) corrupt();
+            std::size_t entries = static_cast<std::size_t>(*p++) + 1;
+            unsigned_type dictionary[detail::columnDictionaryLimit];
+            for (std::size_t e = 0; e < entries; ++e) {
+                unsigned_type z = 0;
+                if (!detail::getVarint(p, limit, z)) corrupt();
+                dictionary[e] = static_cast<unsigned_type>(detail::unzigzag<value_type>(z));
+            }
+            unsigned width = static_cast<unsigned>(detail::bitWidth(entries - 1));
+            if (static_cast<std::size_t>(limit - p) < detail::BitReader::bytesFor(values, width)) corrupt();
+            detail::BitReader reader(p, begin * width);
+            for (std::size_t i = begin; i < end; ++i) {
+                auto e = reader.template get<std::size_t>(width);
+                if (e >= entries) corrupt();
+                store(i, dictionary[e]);
+            }
+        }
+    }
+}
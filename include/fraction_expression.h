@@ -0,0 +1,286 @@
+/**************************************************************************/
+/*  fraction_expression.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+
+#pragma once
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "fraction.h"
+
+namespace FracLib {
+    namespace detail {
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Expression Nodes
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Every node can `fold` itself into an unreduced numerator and denominator in the
+        // fraction's wide type, returning false if an intermediate overflows, and can `step`
+        // through the ordinary operators instead, one temporary per operation. `bits` bounds
+        // the magnitude of the folded components by 2^bits, so operations whose result is
+        // known to fit skip the overflow check.
+
+        /// @brief True when magnitudes up to 2^Bits always fit in W.
+        template <typename W, int Bits>
+        inline constexpr bool foldFits = !IsInteger<W>::value || Bits <= static_cast<int>(sizeof(W) * 8) - 2;
+
+        template <bool Fits, typename W>
+        constexpr bool foldAdd(const W& a, const W& b, W& result) {
+            if constexpr (Fits) {
+                result = a + b;
+                return false;
+            } else {
+                return addOverflow(a, b, result);
+            }
+        }
+        template <bool Fits, typename W>
+        constexpr bool foldSub(const W& a, const W& b, W& result) {
+            if constexpr (Fits) {
+                result = a - b;
+                return false;
+            } else {
+                return subOverflow(a, b, result);
+            }
+        }
+        template <bool Fits, typename W>
+        constexpr bool foldMul(const W& a, const W& b, W& result) {
+            if constexpr (Fits) {
+                result = a * b;
+                return false;
+            } else {
+                return mulOverflow(a, b, result);
+            }
+        }
+
+        /// @brief An operand passed to `fuse` as an lvalue, held by reference.
+        template <typename F>
+        struct ExpressionRef {
+            using fraction_type = F;
+            static constexpr int bits = static_cast<int>(sizeof(typename F::value_type) * 8) - 1;
+            const F& value;
+
+            template <typename W>
+            constexpr bool fold(W& n, W& d) const {
+                n = static_cast<W>(value.numerator);
+                d = static_cast<W>(value.denominator);
+                return true;
+            }
+            constexpr F step() const { return value; }
+        };
+
+        /// @brief A temporary or an integer operand, held by value.
+        template <typename F>
+        struct ExpressionValue {
+            using fraction_type = F;
+            static constexpr int bits = static_cast<int>(sizeof(typename F::value_type) * 8) - 1;
+            F value;
+
+            template <typename W>
+            constexpr bool fold(W& n, W& d) const {
+                n = static_cast<W>(value.numerator);
+                d = static_cast<W>(value.denominator);
+                return true;
+            }
+            constexpr F step() const { return value; }
+        };
+
+        template <bool Subtract>
+        struct ExpressionAddSubtract {
+            static constexpr int bits(int left, int right) { return left + right + 1; }
+
+            template <typename F, int LeftBits, int RightBits, typename W>
+            static constexpr bool fold(const W& a, const W& b, const W& c, const W& d, W& n, W& q) {
+                constexpr bool sumFits = foldFits<W, (LeftBits > RightBits ? LeftBits : RightBits) + 1>;
+                if (b == d) {
+                    q = b;
+                    return !(Subtract ? foldSub<sumFits>(a, c, n) : foldAdd<sumFits>(a, c, n));
+                }
+                constexpr bool productFits = foldFits<W, LeftBits + RightBits>;
+                W x{}, y{};
+                if (foldMul<productFits>(a, d, x) | foldMul<productFits>(c, b, y) | foldMul<productFits>(b, d, q)) return false;
+                constexpr bool crossFits = foldFits<W, LeftBits + RightBits + 1>;
+                return !(Subtract ? foldSub<crossFits>(x, y, n) : foldAdd<crossFits>(x, y, n));
+            }
+            template <typename F>
+            static constexpr F step(const F& x, const F& y) { return F(Subtract ? x - y : x + y); }
+        };
+        using ExpressionAdd = ExpressionAddSubtract<false>;
+        using ExpressionSubtract = ExpressionAddSubtract<true>;
+
+        struct ExpressionMultiply {
+            static constexpr int bits(int left, int right) { return left + right; }
+
+            template <typename F, int LeftBits, int RightBits, typename W>
+            static constexpr bool fold(const W& a, const W& b, const W& c, const W& d, W& n, W& q) {
+                constexpr bool fits = foldFits<W, LeftBits + RightBits>;
+                return !(foldMul<fits>(a, c, n) | foldMul<fits>(b, d, q));
+            }
+            template <typename F>
+            static constexpr F step(const F& x, const F& y) { return F(x * y); }
+        };
+
+        struct ExpressionDivide {
+            static constexpr int bits(int left, int right) { return left + right; }
+
+            template <typename F, int LeftBits, int RightBits, typename W>
+            static constexpr bool fold(const W& a, const W& b, const W& c, const W& d, W& n, W& q) {
+                if (c == 0) {
+                    detail::throwError(std::invalid_argument(F::ZERO_DIVISOR_ERROR));
+                }
+                constexpr bool fits = foldFits<W, LeftBits + RightBits>;
+                return !(foldMul<fits>(a, d, n) | foldMul<fits>(b, c, q));
+            }
+            template <typename F>
+            static constexpr F step(const F& x, const F& y) { return F(x / y); }
+        };
+
+        /// @brief `left Op right`; both operands are nodes, held by value.
+        template <typename Op, typename L, typename R>
+        struct ExpressionNode {
+            using fraction_type = typename L::fraction_type;
+            static constexpr int bits = Op::bits(L::bits, R::bits);
+            L left;
+            R right;
+
+            template <typename W>
+            constexpr bool fold(W& n, W& d) const {
+                W a{}, b{}, c{}, e{};
+                if (!left.fold(a, b) || !right.fold(c, e)) return false;
+                return Op::template fold<fraction_type, L::bits, R::bits>(a, b, c, e, n, d);
+            }
+            constexpr fraction_type step() const { return Op::step(left.step(), right.step()); }
+        };
+
+        template <typename E>
+        struct ExpressionNegate {
+            using fraction_type = typename E::fraction_type;
+            static constexpr int bits = E::bits;
+            E operand;
+
+            template <typename W>
+            constexpr bool fold(W& n, W& d) const {
+                return operand.fold(n, d) && !foldSub<foldFits<W, bits>>(W(0), n, n);
+            }
+            constexpr fraction_type step() const { return -operand.step(); }
+        };
+    }
+
+    /// @brief A deferred fraction expression, built from operands wrapped with `fuse`. Nothing is
+    /// computed until the expression is converted to its fraction type (or `value()` is
+    /// called); the whole expression is then folded into one numerator and denominator in
+    /// `FractionTraits<IntT>::wide_type` and narrowed once, reducing only if the result does
+    /// not fit (or the policy is Normalized, Lazy past its threshold, or BigFraction). If an
+    /// intermediate overflows the wide type, the expression is evaluated again with the
+    /// ordinary operators, so it never fails where they would succeed.
+    /// Expressions refer to the fused lvalues: evaluate them while those are alive.
+    /// @example auto [x, y, z, w] = fuse(a, b, c, d); Fraction32 r = x + y * z - w;
+    template <typename FractionT, typename Node>
+    class FractionExpression {
+    public:
+        using fraction_type = FractionT;
+        using node_type = Node;
+
+    public: // CONSTRUCTORS
+        constexpr explicit FractionExpression(const Node& node) : node_(node) {}
+
+    public: // METHODS
+        /// @brief Evaluates the expression.
+        /// @throws std::invalid_argument If it divides by zero.
+        /// @throws std::overflow_error If the result does not fit and the policy throws.
+        constexpr fraction_type value() const {
+            using W = typename fraction_type::wide_type;
+            W n{}, d{};
+            if (!node_.fold(n, d)) return node_.step();
+            if constexpr (!fraction_type::traits_type::is_bounded && !fraction_type::is_lazy) {
+                return fraction_type(n, d, true);
+            } else {
+                return fraction_type::fromComponents(n, d);
+            }
+        }
+        constexpr operator fraction_type() const { return value(); }
+        constexpr const Node& node() const { return node_; }
+
+    public: // OPERATORS
+        constexpr FractionExpression<FractionT, detail::ExpressionNegate<Node>> operator-() const {
+            return FractionExpression<FractionT, detail::ExpressionNegate<Node>>({node_});
+        }
+
+        template <typename R>
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionAdd, Node, R>> operator+(const FractionExpression& x, const FractionExpression<FractionT, R>& y) { return combine<detail::ExpressionAdd>(x.node_, y.node()); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionAdd, Node, detail::ExpressionValue<FractionT>>> operator+(const FractionExpression& x, const FractionT& y) { return combine<detail::ExpressionAdd>(x.node_, detail::ExpressionValue<FractionT>{y}); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionAdd, detail::ExpressionValue<FractionT>, Node>> operator+(const FractionT& x, const FractionExpression& y) { return combine<detail::ExpressionAdd>(detail::ExpressionValue<FractionT>{x}, y.node()); }
+
+        template <typename R>
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionSubtract, Node, R>> operator-(const FractionExpression& x, const FractionExpression<FractionT, R>& y) { return combine<detail::ExpressionSubtract>(x.node_, y.node()); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionSubtract, Node, detail::ExpressionValue<FractionT>>> operator-(const FractionExpression& x, const FractionT& y) { return combine<detail::ExpressionSubtract>(x.node_, detail::ExpressionValue<FractionT>{y}); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionSubtract, detail::ExpressionValue<FractionT>, Node>> operator-(const FractionT& x, const FractionExpression& y) { return combine<detail::ExpressionSubtract>(detail::ExpressionValue<FractionT>{x}, y.node()); }
+
+        template <typename R>
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionMultiply, Node, R>> operator*(const FractionExpression& x, const FractionExpression<FractionT, R>& y) { return combine<detail::ExpressionMultiply>(x.node_, y.node()); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionMultiply, Node, detail::ExpressionValue<FractionT>>> operator*(const FractionExpression& x, const FractionT& y) { return combine<detail::ExpressionMultiply>(x.node_, detail::ExpressionValue<FractionT>{y}); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionMultiply, detail::ExpressionValue<FractionT>, Node>> operator*(const FractionT& x, const FractionExpression& y) { return combine<detail::ExpressionMultiply>(detail::ExpressionValue<FractionT>{x}, y.node()); }
+
+        template <typename R>
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionDivide, Node, R>> operator/(const FractionExpression& x, const FractionExpression<FractionT, R>& y) { return combine<detail::ExpressionDivide>(x.node_, y.node()); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionDivide, Node, detail::ExpressionValue<FractionT>>> operator/(const FractionExpression& x, const FractionT& y) { return combine<detail::ExpressionDivide>(x.node_, detail::ExpressionValue<FractionT>{y}); }
+        friend constexpr FractionExpression<FractionT, detail::ExpressionNode<detail::ExpressionDivide, detail::ExpressionValue<FractionT>, Node>> operator/(const FractionT& x, const FractionExpression& y) { return combine<detail::ExpressionDivide>(detail::ExpressionValue<FractionT>{x}, y.node()); }
+
+    private:
+        template <typename Op, typename L, typename R>
+        static constexpr FractionExpression<FractionT, detail::ExpressionNode<Op, L, R>> combine(const L& left, const R& right) {
+            return FractionExpression<FractionT, detail::ExpressionNode<Op, L, R>>({left, right});
+        }
+
+        Node node_;
+    };
+
+    /// @brief Wraps a fraction so that arithmetic on it builds a FractionExpression. Operands
+    /// that are not wrapped (fractions of the same type, integers) join the expression by value,
+    /// but `fuse(a) + b * c` still computes `b * c` with the ordinary operators first: wrap
+    /// every fraction that should take part, or use the multi-operand overload.
+    /// @example Fraction32 r = fuse(a) + fuse(b) * fuse(c) - d;
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionExpression<BasicFraction<IntT, OverflowPolicy>, detail::ExpressionRef<BasicFraction<IntT, OverflowPolicy>>> fuse(const BasicFraction<IntT, OverflowPolicy>& value) {
+        using F = BasicFraction<IntT, OverflowPolicy>;
+        return FractionExpression<F, detail::ExpressionRef<F>>(detail::ExpressionRef<F>{value});
+    }
+    /// @brief Temporaries are copied into the expression, so it can outlive them.
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionExpression<BasicFraction<IntT, OverflowPolicy>, detail::ExpressionValue<BasicFraction<IntT, OverflowPolicy>>> fuse(BasicFraction<IntT, OverflowPolicy>&& value) {
+        using F = BasicFraction<IntT, OverflowPolicy>;
+        return FractionExpression<F, detail::ExpressionValue<F>>(detail::ExpressionValue<F>{std::move(value)});
+    }
+    /// @brief Wraps several fractions at once, for structured bindings.
+    /// @example auto [x, y, z] = fuse(a, b, c); Fraction64 r = (x + y) / z;
+    template <typename First, typename Second, typename... Rest>
+    constexpr auto fuse(First&& first, Second&& second, Rest&&... rest) {
+        return std::make_tuple(fuse(std::forward<First>(first)), fuse(std::forward<Second>(second)), fuse(std::forward<Rest>(rest))...);
+    }
+}
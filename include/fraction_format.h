@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*  fraction_format.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include "fraction_traits.h"
+#include "fraction_gcd.h"
+
+namespace FracLib {
+    /// @brief Text forms produced by `to_chars`.
+    enum class FractionFormat : std::uint8_t {
+        Improper, ///< "a/b" exactly as stored, like toString.
+        Mixed,    ///< "w a/b" with 0 < a < b, "w" for integers and "a/b" when |value| < 1. Sign in front.
+        Reduced   ///< "a/b" in lowest terms with a positive denominator.
+    };
+
+    /// @brief Outcome of the batch `to_chars`. `count` values (each followed by the separator)
+    /// were written up to `ptr`; `ec` is `std::errc::value_too_large` if not all of them fit.
+    struct BatchFormatResult {
+        char* ptr;
+        std::errc ec;
+        std::size_t count;
+    };
+
+    /// @brief Upper bound on the characters `to_chars` writes for one fraction with `IntT`
+    /// components, in any format. A buffer of `count * (maxFormattedChars<IntT> + 1)` always
+    /// holds a batch of `count` values and separators.
+    template <typename IntT>
+    inline constexpr std::size_t maxFormattedChars = 3 * ((8 * sizeof(IntT) * 30103) / 100000 + 1) + 3;
+
+    namespace detail {
+        inline constexpr char digitPairs[201] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        inline constexpr std::uint64_t powersOfTen[20] = {
+            1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+            1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+            100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+            1000000000000000000ull, 10000000000000000000ull
+        };
+
+        /// @brief Number of decimal digits in `value` (1 for 0). log10 is estimated from the bit
+        /// width (1233/4096 ~ log10(2)) and corrected with one table lookup, no division.
+        constexpr int decimalDigits(std::uint64_t value) noexcept {
+            value |= 1; // same digit count, and 0 counts as one digit
+            int estimate = (bitWidth(value) * 1233) >> 12;
+            return estimate + (value >= powersOfTen[estimate]);
+        }
+
+        /// @brief Writes the decimal digits of `value` (< 10^8) ending at `end`, two at a time
+        /// in 32-bit arithmetic. Returns the first digit written.
+        constexpr char* writeDigits32(char* end, std::uint32_t value) noexcept {
+            char* p = end;
+            while (value >= 100) {
+                std::uint32_t pair = (value % 100) * 2;
+                value /= 100;
+                *--p = digitPairs[pair + 1];
+                *--p = digitPairs[pair];
+            }
+            if (value >= 10) {
+                std::uint32_t pair = value * 2;
+                *--p = digitPairs[pair + 1];
+                *--p = digitPairs[pair];
+            } else {
+                *--p = static_cast<char>('0' + value);
+            }
+            return p;
+        }
+
+        /// @brief Writes exactly `digits` decimal digits of `value` ending at `end`, zero padded.
+        /// Values of 10^8 and above are split into 8-digit groups so each group is converted with
+        /// cheap 32-bit divisions, independently of the others.
+        constexpr void writeDigits(char* end, std::uint64_t value, int digits) noexcept {
+            char* p = end;
+            while (value >= 100000000) {
+                auto group = static_cast<std::uint32_t>(value % 100000000);
+                value /= 100000000;
+                char* groupStart = writeDigits32(p, group);
+                while (groupStart > p - 8) *--groupStart = '0';
+                p -= 8;
+            }
+            p = writeDigits32(p, static_cast<std::uint32_t>(value));
+            while (p > end - digits) *--p = '0';
+        }
+
+        /// @brief Writes an unsigned magnitude with an optional '-' at `first`.
+        /// @return One past the last character, or nullptr if `[first, last)` is too small.
+        template <typename U>
+        constexpr char* writeInteger(char* first, char* last, bool negative, U value) noexcept {
+            if (negative) {
+                if (first == last) return nullptr;
+                *first++ = '-';
+            }
+            if constexpr (sizeof(U) > sizeof(std::uint64_t)) {
+                // Split off groups of 19 digits, each fits in 64 bits
+                constexpr U group = static_cast<U>(powersOfTen[19]);
+                if (value > static_cast<U>(~std::uint64_t(0))) {
+                    std::uint64_t parts[3] = {};
+                    int count = 0;
+                    while (value >= group) {
+                        parts[count++] = static_cast<std::uint64_t>(value % group);
+                        value /= group;
+                    }
+                    int leading = decimalDigits(static_cast<std::uint64_t>(value));
+                    if (last - first < leading + 19 * count) return nullptr;
+                    writeDigits(first + leading, static_cast<std::uint64_t>(value), leading);
+                    first += leading;
+                    while (count > 0) {
+                        writeDigits(first + 19, parts[--count], 19);
+                        first += 19;
+                    }
+                    return first;
+                }
+            }
+            auto small = static_cast<std::uint64_t>(value);
+            int digits = decimalDigits(small);
+            if (last - first < digits) return nullptr;
+            writeDigits(first + digits, small, digits);
+            return first + digits;
+        }
+
+        constexpr char* writeChar(char* first, char* last, char c) noexcept {
+            if (first == nullptr || first == last) return nullptr;
+            *first = c;
+            return first + 1;
+        }
+    }
+}
@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*  fraction_gcd.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include "fraction_traits.h"
+#include "fraction_stats.h"
+
+// Operands below this bound are reduced with a precomputed table instead of a loop.
+// The table holds FRACLIB_GCD_TABLE_BOUND^2 entries (64 KiB at the default of 256);
+// define it to 0 to disable the table.
+#ifndef FRACLIB_GCD_TABLE_BOUND
+#define FRACLIB_GCD_TABLE_BOUND 256
+#endif
+
+namespace FracLib {
+    namespace detail {
+        /// @brief Unsigned type with the same width as `T`.
+        template <typename T> struct UnsignedOf { using type = std::make_unsigned_t<T>; };
+#ifdef FRACLIB_HAS_INT128
+        template <> struct UnsignedOf<int128_t> { using type = uint128_t; };
+        template <> struct UnsignedOf<uint128_t> { using type = uint128_t; };
+#endif
+        template <typename T>
+        using UnsignedOfT = typename UnsignedOf<T>::type;
+
+        /// @brief |value| as an unsigned integer. Well defined for the most negative value.
+        template <typename T>
+        constexpr UnsignedOfT<T> magnitude(T value) noexcept {
+            using U = UnsignedOfT<T>;
+            return value < 0 ? static_cast<U>(U(0) - static_cast<U>(value)) : static_cast<U>(value);
+        }
+
+        /// @brief Number of trailing zero bits. `value` must not be zero.
+        template <typename U>
+        constexpr int countTrailingZeros(U value) noexcept {
+            if constexpr (sizeof(U) <= sizeof(unsigned int)) {
+                return __builtin_ctz(static_cast<unsigned int>(value));
+            } else if constexpr (sizeof(U) <= sizeof(unsigned long long)) {
+                return __builtin_ctzll(static_cast<unsigned long long>(value));
+            } else {
+                auto low = static_cast<unsigned long long>(value);
+                return low != 0 ? __builtin_ctzll(low)
+                                : 64 + __builtin_ctzll(static_cast<unsigned long long>(value >> 64));
+            }
+        }
+
+        /// @brief Number of bits needed to represent `value` (0 for 0).
+        template <typename U>
+        constexpr int bitWidth(U value) noexcept {
+            int width = 0;
+            if constexpr (sizeof(U) > sizeof(unsigned long long)) {
+                auto high = static_cast<unsigned long long>(value >> 64);
+                if (high != 0) return 128 - __builtin_clzll(high);
+            }
+            auto low = static_cast<unsigned long long>(value);
+            if (low != 0) width = 64 - __builtin_clzll(low);
+            return width;
+        }
+
+        /// @brief Stein's binary GCD. Subtract-and-shift only, no division. Both operands are
+        /// kept odd, and the min/difference update compiles to conditional moves, so the loop
+        /// carries a single short dependency chain instead of a data-dependent branch.
+        template <typename U>
+        constexpr U binaryGcd(U u, U v) noexcept {
+            if (u == 0) return v;
+            if (v == 0) return u;
+            int shift = countTrailingZeros(static_cast<U>(u | v));
+            u >>= countTrailingZeros(u);
+            v >>= countTrailingZeros(v);
+            std::uint64_t iterations = 0;
+            while (u != v) {
+                U low = u < v ? u : v;
+                U high = u < v ? v : u;
+                U difference = static_cast<U>(high - low); // even and non-zero
+                u = low;
+                v = static_cast<U>(difference >> countTrailingZeros(difference));
+                ++iterations;
+            }
+            instrument(Counter::GcdIterations, iterations);
+            return static_cast<U>(u << shift);
+        }
+
+#if FRACLIB_GCD_TABLE_BOUND > 0
+        using GcdTableEntry = std::conditional_t<(FRACLIB_GCD_TABLE_BOUND <= 256), std::uint8_t, std::uint16_t>;
+
+        struct GcdTable {
+            GcdTableEntry values[FRACLIB_GCD_TABLE_BOUND][FRACLIB_GCD_TABLE_BOUND];
+        };
+
+        constexpr GcdTable makeGcdTable() noexcept {
+            GcdTable table{};
+            // gcd(a, b) = gcd(a, b - a): fill each row from the already computed entries.
+            for (unsigned a = 0; a < FRACLIB_GCD_TABLE_BOUND; ++a) {
+                for (unsigned b = 0; b < FRACLIB_GCD_TABLE_BOUND; ++b) {
+                    if (a == 0 || b == 0) {
+                        table.values[a][b] = static_cast<GcdTableEntry>(a + b);
+                    } else if (a < b) {
+                        table.values[a][b] = table.values[a][b - a];
+                    } else if (a > b) {
+                        table.values[a][b] = table.values[a - b][b];
+                    } else {
+                        table.values[a][b] = static_cast<GcdTableEntry>(a);
+                    }
+                }
+            }
+            return table;
+        }
+
+        inline constexpr GcdTable gcdTable = makeGcdTable();
+#endif
+
+        /// @brief Looks up gcd(a, b) when both operands are below the table bound.
+        template <typename U>
+        constexpr bool gcdFromTable(U a, U b, U& result) noexcept {
+#if FRACLIB_GCD_TABLE_BOUND > 0
+            if (a < FRACLIB_GCD_TABLE_BOUND && b < FRACLIB_GCD_TABLE_BOUND) {
+                result = static_cast<U>(gcdTable.values[static_cast<unsigned>(a)][static_cast<unsigned>(b)]);
+                return true;
+            }
+#endif
+            (void)a; (void)b; (void)result;
+            return false;
+        }
+
+        /// @brief GCD of two magnitudes. The algorithm is chosen from the operand width:
+        /// small operands use the lookup table, 128-bit operands drop to 64-bit arithmetic as
+        /// soon as both fit, everything else runs the binary GCD. When one operand is much
+        /// larger (a big numerator over a small denominator) a single Euclid step brings both
+        /// into the small range first.
+        template <typename U>
+        constexpr U gcdMagnitude(U a, U b) noexcept {
+            instrument(Counter::GcdCalls);
+            U result = 0;
+            if (gcdFromTable(a, b, result)) return result;
+
+            U high = a < b ? b : a;
+            U low = a < b ? a : b;
+            if (low == 0) return high;
+            if ((high >> 4) > low) {
+                high %= low;
+                if (high == 0) return low;
+                if (gcdFromTable(high, low, result)) return result;
+            }
+            a = high;
+            b = low;
+
+            if constexpr (sizeof(U) < sizeof(unsigned int)) {
+                // Promoted anyway, run the loop at native width
+                return static_cast<U>(binaryGcd<unsigned int>(a, b));
+            } else if constexpr (sizeof(U) > sizeof(std::uint64_t)) {
+                constexpr U low64 = static_cast<U>(~std::uint64_t(0));
+                if (a <= low64 && b <= low64) {
+                    return static_cast<U>(binaryGcd<std::uint64_t>(static_cast<std::uint64_t>(a), static_cast<std::uint64_t>(b)));
+                }
+                return binaryGcd<U>(a, b);
+            } else {
+                return binaryGcd<U>(a, b);
+            }
+        }
+    }
+
+    /// @brief Greatest Common Divisor of |a| and |b|. `gcd(0, b)` is |b| and `gcd(0, 0)` is 0.
+    /// The result is returned as the unsigned type of the same width, since gcd(min, 0) = |min|
+    /// does not fit in the signed type.
+    template <typename IntT, detail::EnableIfInteger<IntT> = 0>
+    constexpr detail::UnsignedOfT<IntT> gcd(IntT a, IntT b) noexcept {
+        return detail::gcdMagnitude(detail::magnitude(a), detail::magnitude(b));
+    }
+}
@@ -0,0 +1,1673 @@
+/**************************************************************************/
+/*  fraction_impl.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+// Out-of-class definitions for BasicFraction. Included by fraction.h, do not include directly.
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+
+namespace FracLib {
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Utilities
+    //\\\\\\\\\\\\\\\\\\\\/
+    namespace detail {
+        /// @brief Formats any supported integer (including `__int128`) as decimal text.
+        template <typename T>
+        std::string integerToString(T value) {
+            if constexpr (!FractionTraits<T>::is_bounded) {
+                return value.toString();
+            } else {
+                char buffer[48];
+                char* end = writeInteger(buffer, buffer + sizeof(buffer), value < 0, magnitude(value));
+                return std::string(buffer, end);
+            }
+        }
+
+        /// @brief `to_chars` for built-in components, on unsigned magnitudes so the most
+        /// negative value needs no special case.
+        /// @return One past the last character, or nullptr if the range is too small.
+        template <typename IntT>
+        char* formatComponents(char* first, char* last, IntT n, IntT d, FractionFormat format) noexcept {
+            using U = UnsignedOfT<IntT>;
+            U un = magnitude(n);
+            U ud = magnitude(d);
+            if (format == FractionFormat::Improper || ud == 0) {
+                char* p = writeChar(writeInteger(first, last, n < 0, un), last, '/');
+                return p ? writeInteger(p, last, d < 0, ud) : nullptr;
+            }
+
+            bool negative = un != 0 && ((n < 0) != (d < 0));
+            if (format == FractionFormat::Reduced) {
+                U g = gcdMagnitude(un, ud);
+                char* p = writeChar(writeInteger(first, last, negative, static_cast<U>(un / g)), last, '/');
+                return p ? writeInteger(p, last, false, static_cast<U>(ud / g)) : nullptr;
+            }
+
+            // Mixed: "w", "a/b" or "w a/b"
+            U whole = un / ud;
+            U rest = un % ud;
+            if (rest == 0) return writeInteger(first, last, negative, whole);
+            char* p = first;
+            if (whole != 0) {
+                p = writeChar(writeInteger(p, last, negative, whole), last, ' ');
+                negative = false;
+                if (!p) return nullptr;
+            }
+            p = writeChar(writeInteger(p, last, negative, rest), last, '/');
+            return p ? writeInteger(p, last, false, ud) : nullptr;
+        }
+
+        /// @brief Copies `text` to `first`, or returns nullptr if it does not fit.
+        inline char* writeText(char* first, char* last, const std::string& text) noexcept {
+            if (first == nullptr || static_cast<std::size_t>(last - first) < text.size()) return nullptr;
+            return std::copy(text.begin(), text.end(), first);
+        }
+
+        static_assert(std::numeric_limits<double>::is_iec559, "Exact double conversion needs IEEE-754 doubles.");
+
+        /// @brief Splits a finite double into `|value| = mantissa * 2^exponent` with an odd
+        /// mantissa (or 0), straight from the IEEE-754 bits.
+        inline void decomposeDouble(double value, bool& negative, std::uint64_t& mantissa, int& exponent) noexcept {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            negative = (bits >> 63) != 0;
+            int biased = static_cast<int>((bits >> 52) & 0x7FF);
+            mantissa = bits & ((std::uint64_t(1) << 52) - 1);
+            if (biased != 0) {
+                mantissa |= std::uint64_t(1) << 52; // implicit leading bit
+            } else {
+                biased = 1; // subnormal
+            }
+            exponent = biased - 1075;
+            if (mantissa != 0) {
+                int zeros = countTrailingZeros(mantissa);
+                mantissa >>= zeros;
+                exponent += zeros;
+            }
+        }
+
+        /// @brief Compares an/ad with bn/bd (all positive) by their continued fractions, without
+        /// multiplying: the first differing partial quotient decides, and each step swaps the
+        /// roles of numerator and denominator, which reverses the order.
+        template <typename U>
+        constexpr int compareMagnitudes(U an, U ad, U bn, U bd) noexcept {
+            int order = 1;
+            for (;;) {
+                U qa = an / ad;
+                U qb = bn / bd;
+                if (qa != qb) return qa < qb ? -order : order;
+                U ra = an - qa * ad;
+                U rb = bn - qb * bd;
+                if (ra == 0 || rb == 0) {
+                    if (ra == rb) return 0;
+                    return ra == 0 ? -order : order;
+                }
+                // an/ad = q + ra/ad, so comparing the fractional parts means comparing ad/ra
+                an = ad;
+                ad = ra;
+                bn = bd;
+                bd = rb;
+                order = -order;
+            }
+        }
+
+        /// @brief Orders two same-sign values from approximations `x` and `y`, each within a
+        /// relative error of 2^-51 of its value (a quotient of two correctly rounded conversions
+        /// is within 3 units of 2^-53). The true difference is then within 2^-51 * (|x| + |y|) of
+        /// x - y; testing against twice that also covers rounding in the test itself.
+        /// @return -1 or 1, or 0 if the approximations cannot decide (too close, or outside the
+        /// range where the relative bound holds).
+        constexpr int filteredOrder(double x, double y) noexcept {
+            double ax = x < 0 ? -x : x;
+            double ay = y < 0 ? -y : y;
+            // Also rejects NaN and the infinities of ratios that left double's range
+            constexpr double low = 0x1p-900, high = 0x1p+900;
+            if (!(ax >= low && ax <= high && ay >= low && ay <= high)) return 0;
+            double bound = (ax + ay) * 0x1p-50;
+            double difference = x - y;
+            if (difference > bound) return 1;
+            if (difference < -bound) return -1;
+            return 0;
+        }
+
+        /// @brief filteredOrder, counted in the calling thread's CompareStats.
+        constexpr int countedFilteredOrder(double x, double y) noexcept {
+            int order = filteredOrder(x, y);
+            if (!isConstantEvaluated()) {
+                CompareStats& counters = compareCounters();
+                ++(order != 0 ? counters.filtered : counters.exact);
+            }
+            return order;
+        }
+
+        /// @brief Counts a Normalized or Lazy result in the calling thread's ReductionStats.
+        constexpr void countReduction(bool deferred) noexcept {
+            if (!isConstantEvaluated()) {
+                ReductionStats& counters = reductionCounters();
+                ++(deferred ? counters.deferred : counters.reduced);
+            }
+        }
+
+        /// @brief splitmix64's finalizer: spreads every input bit over the result.
+        constexpr std::uint64_t mixBits(std::uint64_t x) noexcept {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            return x ^ (x >> 31);
+        }
+
+        /// @brief Hash of a fraction's value from its reduced magnitudes and sign.
+        template <typename U>
+        constexpr std::size_t hashReduced(bool negative, U n, U d) noexcept {
+            std::uint64_t h = mixBits(static_cast<std::uint64_t>(n) ^ (negative ? 0x9e3779b97f4a7c15ull : 0));
+            h = mixBits(h + static_cast<std::uint64_t>(d));
+            if constexpr (sizeof(U) > sizeof(std::uint64_t)) {
+                h = mixBits(h + static_cast<std::uint64_t>(n >> 64));
+                h = mixBits(h + static_cast<std::uint64_t>(d >> 64));
+            }
+            return static_cast<std::size_t>(h);
+        }
+
+        /// @brief Closest p/q to n/d (n >= 0, d > maxDenominator >= 1) with q <= maxDenominator.
+        /// Runs the continued fraction of n/d until the next convergent's denominator exceeds the
+        /// bound, then compares the last convergent with the largest semiconvergent that fits.
+        /// The convergent wins ties, as in Python's Fraction.limit_denominator.
+        template <typename M>
+        constexpr void limitMagnitude(M n, M d, M maxDenominator, M& p, M& q) noexcept(IsInteger<M>::value) {
+            const M originalDenominator = d;
+            M p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+            for (;;) {
+                M a = n / d;
+                M q2 = 0;
+                if (mulOverflow(a, q1, q2) || addOverflow(q0, q2, q2) || q2 > maxDenominator) break;
+                // Convergent numerators never exceed n, so p2 cannot overflow
+                M p2 = p0 + a * p1;
+                p0 = p1;
+                q0 = q1;
+                p1 = p2;
+                q1 = q2;
+                M r = n - a * d;
+                n = d;
+                d = r;
+                if (d == 0) { // n/d was not in lowest terms and its reduced form fits
+                    p = p1;
+                    q = q1;
+                    return;
+                }
+            }
+            // The first step always fits (q = 1), so q1 >= 1 here
+            M k = (maxDenominator - q0) / q1;
+            M semiP = p0 + k * p1;
+            M semiQ = q0 + k * q1;
+            // The two candidates are 1/(q1 * semiQ) apart and the convergent is d/(q1 * D) from
+            // n/d, so the convergent is at least as close when 2 * d * semiQ <= D.
+            M twice = 0;
+            bool convergentCloser = !mulOverflow(d, semiQ, twice) && !addOverflow(twice, twice, twice) &&
+                twice <= originalDenominator;
+            p = convergentCloser ? p1 : semiP;
+            q = convergentCloser ? q1 : semiQ;
+        }
+
+        /// @brief Stores `(negative ? -p : p) / q` in built-in `IntT` components.
+        /// @return false if `p` or `q` does not fit.
+        template <typename IntT, typename M>
+        constexpr bool assignMagnitudes(bool negative, M p, M q, IntT& numerator, IntT& denominator) noexcept {
+            using U = UnsignedOfT<IntT>;
+            // Compare in the wider of the two unsigned types
+            using W = std::conditional_t<(sizeof(M) > sizeof(U)), M, U>;
+            constexpr W max = static_cast<W>(FractionTraits<IntT>::max());
+            if (static_cast<W>(q) > max || static_cast<W>(p) > max + static_cast<W>(negative)) return false;
+            U magnitude = static_cast<U>(p);
+            numerator = negative ? static_cast<IntT>(U(0) - magnitude) : static_cast<IntT>(magnitude);
+            denominator = static_cast<IntT>(q);
+            return true;
+        }
+
+        /// @brief limitDenominator of a double's exact value into built-in `IntT` components.
+        /// Works on the dyadic form m / 2^k directly: in 64-bit arithmetic when k < 64, in
+        /// 128-bit arithmetic up to k = 126.
+        /// @return false if `value` is not finite or the result does not fit.
+        template <typename IntT>
+        bool limitDouble(double value, UnsignedOfT<IntT> maxDenominator, IntT& numerator, IntT& denominator) noexcept {
+            if (!std::isfinite(value)) return false;
+            bool negative = false;
+            std::uint64_t mantissa = 0;
+            int exponent = 0;
+            decomposeDouble(value, negative, mantissa, exponent);
+            if (mantissa == 0) return assignMagnitudes(false, std::uint64_t(0), std::uint64_t(1), numerator, denominator);
+
+            if (exponent >= 0) {
+                // An integer is its own best approximation
+                constexpr int valueBits = 8 * static_cast<int>(sizeof(IntT)) - 1;
+                if (bitWidth(mantissa) + exponent > valueBits + 1) return false;
+                using U = UnsignedOfT<IntT>;
+                return assignMagnitudes(negative, static_cast<U>(static_cast<U>(mantissa) << exponent), U(1), numerator, denominator);
+            }
+
+            int shift = -exponent;
+            // |value| < 2^(width - shift) <= 1/(2 * maxDenominator): nothing beats 0
+            if (bitWidth(mantissa) - shift <= -(bitWidth(maxDenominator) + 1)) {
+                return assignMagnitudes(false, std::uint64_t(0), std::uint64_t(1), numerator, denominator);
+            }
+            if (shift < 64) {
+                std::uint64_t d = std::uint64_t(1) << shift;
+                std::uint64_t p = mantissa, q = d;
+                if (d > maxDenominator) limitMagnitude<std::uint64_t>(mantissa, d, static_cast<std::uint64_t>(maxDenominator), p, q);
+                return assignMagnitudes(negative, p, q, numerator, denominator);
+            }
+#ifdef FRACLIB_HAS_INT128
+            if (shift < 127) {
+                uint128_t d = uint128_t(1) << shift;
+                uint128_t p = mantissa, q = d;
+                if (d > maxDenominator) limitMagnitude<uint128_t>(mantissa, d, static_cast<uint128_t>(maxDenominator), p, q);
+                return assignMagnitudes(negative, p, q, numerator, denominator);
+            }
+#endif
+            return false;
+        }
+
+        /// @brief A double's exact value in built-in `IntT` components when it fits, otherwise
+        /// the closest fraction that does: limitDouble with the largest denominator that still
+        /// leaves room for the numerator, halved until the result fits. Near the ends of the
+        /// range only integers are left (2147483647.5 becomes 2147483647 in 32 bits).
+        /// @return false if `value` is not finite or its magnitude is out of `IntT`'s range.
+        template <typename IntT>
+        bool nearestDouble(double value, IntT& numerator, IntT& denominator) noexcept {
+            if (!std::isfinite(value)) return false;
+            bool negative = false;
+            std::uint64_t mantissa = 0;
+            int exponent = 0;
+            decomposeDouble(value, negative, mantissa, exponent);
+            using U = UnsignedOfT<IntT>;
+            constexpr int valueBits = 8 * static_cast<int>(sizeof(IntT)) - 1;
+            int width = bitWidth(mantissa);
+            bool minimum = negative && mantissa == 1 && exponent == valueBits;
+            if (mantissa == 0 || (exponent >= 0 ? (width + exponent <= valueBits || minimum)
+                                                : (width <= valueBits && -exponent <= valueBits - 1))) {
+                U magnitude = static_cast<U>(mantissa);
+                U scale = 1;
+                if (exponent >= 0) {
+                    magnitude = static_cast<U>(magnitude << exponent);
+                } else {
+                    scale = static_cast<U>(scale << -exponent);
+                }
+                numerator = negative ? static_cast<IntT>(U(0) - magnitude) : static_cast<IntT>(magnitude);
+                denominator = static_cast<IntT>(scale);
+                return true;
+            }
+            if (exponent >= 0) return false; // An integer too wide for IntT
+
+            constexpr U max = static_cast<U>(FractionTraits<IntT>::max());
+            double whole = std::floor(std::fabs(value));
+            U bound = max;
+            if (whole >= 1.0) {
+                double fitting = static_cast<double>(max) / (whole + 1.0);
+                bound = fitting < 1.0 ? U(1) : static_cast<U>(fitting);
+            }
+            for (;;) {
+                if (limitDouble(value, bound, numerator, denominator)) return true;
+                if (bound == 1) return false;
+                bound = static_cast<U>(bound / 2);
+            }
+        }
+
+        /// @brief `to_chars` for arbitrary-precision components. Allocates for the digit strings.
+        template <typename IntT>
+        char* formatUnbounded(char* first, char* last, IntT n, IntT d, FractionFormat format) {
+            if (format == FractionFormat::Improper || d == 0) {
+                return writeText(writeChar(writeText(first, last, integerToString(n)), last, '/'), last, integerToString(d));
+            }
+            if (d < 0) {
+                n = -n;
+                d = -d;
+            }
+            if (format == FractionFormat::Reduced) {
+                IntT g = gcd(n, d);
+                return writeText(writeChar(writeText(first, last, integerToString(n / g)), last, '/'), last, integerToString(d / g));
+            }
+            bool negative = n < 0;
+            if (negative) n = -n;
+            IntT whole = n / d;
+            IntT rest = n % d;
+            char* p = first;
+            if (negative) p = writeChar(p, last, '-');
+            if (rest == 0) return writeText(p, last, integerToString(whole));
+            if (whole != 0) p = writeChar(writeText(p, last, integerToString(whole)), last, ' ');
+            return writeText(writeChar(writeText(p, last, integerToString(rest)), last, '/'), last, integerToString(d));
+        }
+    }
+
+    // Every range check goes through OverflowPolicy, see fraction_policy.h.
+    template <typename IntT, typename OverflowPolicy>
+    constexpr IntT BasicFraction<IntT, OverflowPolicy>::narrow(wide_type value) {
+        return detail::policyNarrow<OverflowPolicy, IntT>(value);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I>
+    constexpr IntT BasicFraction<IntT, OverflowPolicy>::checkedValue(I value) {
+        return detail::policyNarrow<OverflowPolicy, IntT>(value);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::wide_type BasicFraction<IntT, OverflowPolicy>::wideMul(wide_type a, wide_type b) {
+        if constexpr (traits_type::has_wider) {
+            return a * b; // both operands came from IntT, the product always fits
+        } else {
+            return detail::policyMul<OverflowPolicy>(a, b);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::wide_type BasicFraction<IntT, OverflowPolicy>::wideAdd(wide_type a, wide_type b) {
+        return detail::policyAdd<OverflowPolicy>(a, b);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::wide_type BasicFraction<IntT, OverflowPolicy>::wideSub(wide_type a, wide_type b) {
+        return detail::policySub<OverflowPolicy>(a, b);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::fromWide(wide_type n, wide_type d) {
+        return fromComponents(n, d);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename W>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::fromComponents(W n, W d) {
+        BasicFraction result;
+        raiseIfError(tryFromComponents(n, d, result));
+        return result;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename W>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryFromComponents(W n, W d, BasicFraction& out) noexcept(traits_type::is_bounded) {
+        if constexpr (is_normalized && traits_type::is_bounded) {
+            // Reduce before narrowing, so results that only fit in lowest terms still fit
+            if (d == 0) return FractionError::ZeroDivisor;
+            if (reduceInto(n, d, out)) return FractionError::None;
+            return narrowOverflow(n, d, out);
+        }
+        IntT tn = 0, td = 0;
+        bool overflow = detail::convertOverflow(n, tn) | detail::convertOverflow(d, td);
+        if constexpr (OverflowPolicy::checked && traits_type::is_bounded) {
+            if (overflow) {
+                // The exact result may still fit once reduced
+                if (d != 0 && reduceInto(n, d, out)) return FractionError::None;
+                return narrowOverflow(n, d, out);
+            }
+        }
+        if (td == 0) return FractionError::ZeroDivisor;
+        // The (n, d) constructor without its zero check
+        out.numerator = tn;
+        out.denominator = td;
+        if constexpr (is_normalized) {
+            out.simplify();
+        } else {
+            out.setReducedFlag(td == 1);
+            out.settle();
+        }
+        return FractionError::None;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename W>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::narrowOverflow(W n, W d, BasicFraction& out) noexcept(traits_type::is_bounded) {
+        detail::instrument(detail::Counter::Overflows);
+        if constexpr (raises_errors) {
+            return FractionError::Overflow;
+        } else {
+            out = OverflowPolicy::template narrowFraction<BasicFraction>(n, d);
+            return FractionError::None;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::raiseIfError(FractionError error) {
+        if (error != FractionError::None) raiseError(error);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::raiseError(FractionError error) {
+        if (error == FractionError::ZeroDivisor) detail::throwError(std::invalid_argument(ZERO_DIVISOR_ERROR));
+        if (error == FractionError::Overflow) detail::throwError(std::overflow_error(OVERFLOW_ERROR));
+        detail::throwError(std::invalid_argument(INVALID_STRING_PARAMETER_ERROR));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename T>
+    constexpr T BasicFraction<IntT, OverflowPolicy>::unwrap(const FractionResult<T>& result) {
+        raiseIfError(result.error());
+        return result.value();
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::tryCheckedValue(I value, IntT& out) noexcept(traits_type::is_bounded) {
+        if constexpr (raises_errors) {
+            if (!detail::convertOverflow(value, out)) return true;
+            detail::instrument(detail::Counter::Overflows);
+            return false;
+        } else {
+            out = checkedValue(value);
+            return true;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::tryWideMul(wide_type a, wide_type b, wide_type& out) noexcept(traits_type::is_bounded) {
+        if constexpr (traits_type::has_wider) {
+            out = a * b;
+            return true;
+        } else if constexpr (raises_errors) {
+            if (!detail::mulOverflow(a, b, out)) return true;
+            detail::instrument(detail::Counter::Overflows);
+            return false;
+        } else {
+            out = detail::policyMul<OverflowPolicy>(a, b);
+            return true;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::tryWideAdd(wide_type a, wide_type b, wide_type& out) noexcept(traits_type::is_bounded) {
+        if constexpr (raises_errors) {
+            if (!detail::addOverflow(a, b, out)) return true;
+            detail::instrument(detail::Counter::Overflows);
+            return false;
+        } else {
+            out = detail::policyAdd<OverflowPolicy>(a, b);
+            return true;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::tryWideSub(wide_type a, wide_type b, wide_type& out) noexcept(traits_type::is_bounded) {
+        if constexpr (raises_errors) {
+            if (!detail::subOverflow(a, b, out)) return true;
+            detail::instrument(detail::Counter::Overflows);
+            return false;
+        } else {
+            out = detail::policySub<OverflowPolicy>(a, b);
+            return true;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename W>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::reduceInto(W n, W d, BasicFraction& out) noexcept {
+        using WU = detail::UnsignedOfT<W>;
+        WU un = detail::magnitude(n);
+        WU ud = detail::magnitude(d);
+        WU g = detail::gcdMagnitude(un, ud);
+        bool fits = detail::assignMagnitudes(un != 0 && ((n < 0) != (d < 0)), WU(un / g), WU(ud / g), out.numerator, out.denominator);
+        out.setReducedFlag(fits);
+        if constexpr (is_normalized || is_lazy) {
+            if (fits) detail::countReduction(false);
+        }
+        return fits;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::multiplyCancelled(IntT a, IntT b, IntT c, IntT d, BasicFraction& out) noexcept(traits_type::is_bounded) {
+        if constexpr (traits_type::is_bounded) {
+            // Magnitudes, so IntT's minimum and gcds of 2^(bits - 1) need no special cases
+            using U = detail::UnsignedOfT<IntT>;
+            bool negative = ((a < 0) != (b < 0)) != ((c < 0) != (d < 0));
+            U ua = detail::magnitude(a), ub = detail::magnitude(b);
+            U uc = detail::magnitude(c), ud = detail::magnitude(d);
+            U g1 = detail::gcdMagnitude(ua, ud);
+            U g2 = detail::gcdMagnitude(uc, ub);
+            U n = 0, q = 0;
+            if (detail::mulOverflow(U(ua / g1), U(uc / g2), n) || detail::mulOverflow(U(ub / g2), U(ud / g1), q)) return false;
+            out.setReducedFlag(false);
+            return detail::assignMagnitudes(negative && n != 0, n, q, out.numerator, out.denominator);
+        } else {
+            IntT g1 = gcd(a, d);
+            IntT g2 = gcd(c, b);
+            IntT n = (a / g1) * (c / g2);
+            IntT q = (b / g2) * (d / g1);
+            if (q < 0) {
+                n = -n;
+                q = -q;
+            }
+            out.numerator = n;
+            out.denominator = q;
+            out.setReducedFlag(false);
+            return true;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::addSplit(IntT a, IntT b, IntT c, IntT d, bool subtract, BasicFraction& out) noexcept(traits_type::is_bounded) {
+        // The split needs positive denominators; negating IntT's minimum fails the checks below
+        if (b < 0 && (detail::subOverflow(IntT(0), a, a) || detail::subOverflow(IntT(0), b, b))) return false;
+        if ((d < 0) != subtract && detail::subOverflow(IntT(0), c, c)) return false;
+        if (d < 0 && detail::subOverflow(IntT(0), d, d)) return false;
+        IntT g = 0;
+        if constexpr (traits_type::is_bounded) {
+            g = static_cast<IntT>(detail::gcdMagnitude(detail::magnitude(b), detail::magnitude(d)));
+        } else {
+            g = gcd(b, d);
+        }
+        IntT bg = b / g;
+        IntT t = 0, left = 0, right = 0;
+        if (detail::mulOverflow(a, IntT(d / g), left) || detail::mulOverflow(c, bg, right) || detail::addOverflow(left, right, t)) return false;
+        if (t == 0) {
+            out = BasicFraction();
+            return true;
+        }
+        IntT h = g;
+        if (g != 1) {
+            if constexpr (traits_type::is_bounded) {
+                h = static_cast<IntT>(detail::gcdMagnitude(detail::magnitude(t), detail::magnitude(g)));
+            } else {
+                h = gcd(t, g);
+            }
+        }
+        IntT q = 0;
+        if (detail::mulOverflow(bg, IntT(d / h), q)) return false;
+        out.numerator = t / h;
+        out.denominator = q;
+        out.setReducedFlag(false);
+        return true;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction() : numerator(0), denominator(1) {
+        this->setReducedFlag(true);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction(I n) : numerator(checkedValue(n)), denominator(1) {
+        this->setReducedFlag(true);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction(IntT n, IntT d, bool simplify) : numerator(n), denominator(d) {
+        if (denominator == 0){
+            detail::throwError(std::invalid_argument(ZERO_DIVISOR_ERROR));
+        }
+        // Optional
+        if (simplify || is_normalized) {
+            this->simplify();
+        } else {
+            this->setReducedFlag(denominator == 1);
+        }
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename OtherInt, typename OtherPolicy, std::enable_if_t<detail::IsWideningConversion<OtherInt, IntT>::value, int>>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction(const BasicFraction<OtherInt, OtherPolicy>& other)
+        : numerator(static_cast<IntT>(other.numerator)), denominator(static_cast<IntT>(other.denominator)) {
+        if constexpr (is_normalized && !BasicFraction<OtherInt, OtherPolicy>::is_normalized) simplify();
+        this->setReducedFlag(other.knownReduced());
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename OtherInt, typename OtherPolicy, std::enable_if_t<!detail::IsWideningConversion<OtherInt, IntT>::value, int>>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction(const BasicFraction<OtherInt, OtherPolicy>& other)
+        : BasicFraction(fromComponents(other.numerator, other.denominator)) {}
+    template <typename IntT, typename OverflowPolicy>
+    BasicFraction<IntT, OverflowPolicy>::BasicFraction(double decimal, DoubleConversion mode){
+        toFraction(decimal, mode);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction(const char* fracStr, bool simplify) : BasicFraction() {
+        raiseIfError(toFractionError(parseLeading(fracStr, *this, simplify).error));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy>::BasicFraction(std::string_view fracStr, bool simplify)
+        : BasicFraction(unwrap(tryParse(fracStr, simplify))) {}
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Basic Arithmetic Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Thin wrappers over the status API below, which computes intermediates in wide_type and
+    // checks them once when narrowing.
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator+(const BasicFraction& other) const {
+        return unwrap(tryAdd(*this, other));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator+(I value) const {
+        return unwrap(tryAdd(*this, value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator+(double value) const {
+        return *(this) + BasicFraction(value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator+(const char* value) const {
+        return *(this) + BasicFraction(value);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator-(const BasicFraction& other) const {
+        return unwrap(trySubtract(*this, other));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator-(I value) const {
+        return unwrap(trySubtract(*this, value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator-(double value) const {
+        return *(this) - BasicFraction(value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator-(const char* value) const {
+        return *(this) - BasicFraction(value);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator*(const BasicFraction& other) const {
+        return unwrap(tryMultiply(*this, other));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator*(I value) const {
+        return unwrap(tryMultiply(*this, value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator*(double value) const {
+        return *(this) * BasicFraction(value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator*(const char* value) const {
+        return *(this) * BasicFraction(value);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator/(const BasicFraction& other) const {
+        return unwrap(tryDivide(*this, other));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator/(I value) const {
+        return unwrap(tryDivide(*this, value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator/(double value) const {
+        return *(this) / BasicFraction(value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    typename BasicFraction<IntT, OverflowPolicy>::result_type BasicFraction<IntT, OverflowPolicy>::operator/(const char* value) const {
+        return *(this) / BasicFraction(value);
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Status API
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryAdd(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        detail::instrument(detail::Counter::Additions);
+        result_type result;
+        return detail::makeResult(tryAddFractions(a, b, false, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryAdd(const BasicFraction& a, I b) noexcept(traits_type::is_bounded) {
+        IntT value = 0;
+        if (!tryCheckedValue(b, value)) return FractionError::Overflow;
+        detail::instrument(detail::Counter::Additions);
+        result_type result;
+        return detail::makeResult(tryAddInteger(a, value, false, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryAdd(I a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        return tryAdd(b, a);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::trySubtract(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        detail::instrument(detail::Counter::Subtractions);
+        result_type result;
+        return detail::makeResult(tryAddFractions(a, b, true, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::trySubtract(const BasicFraction& a, I b) noexcept(traits_type::is_bounded) {
+        IntT value = 0;
+        if (!tryCheckedValue(b, value)) return FractionError::Overflow;
+        detail::instrument(detail::Counter::Subtractions);
+        result_type result;
+        return detail::makeResult(tryAddInteger(a, value, true, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::trySubtract(I a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        IntT value = 0;
+        if (!tryCheckedValue(a, value)) return FractionError::Overflow;
+        detail::instrument(detail::Counter::Subtractions);
+        result_type result;
+        return detail::makeResult(trySubtractFromInteger(value, b, result), result);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryMultiply(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        detail::instrument(detail::Counter::Multiplications);
+        result_type result;
+        return detail::makeResult(tryMultiplyFractions(a.numerator, a.denominator, b.numerator, b.denominator, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryMultiply(const BasicFraction& a, I b) noexcept(traits_type::is_bounded) {
+        IntT value = 0;
+        if (!tryCheckedValue(b, value)) return FractionError::Overflow;
+        detail::instrument(detail::Counter::Multiplications);
+        result_type result;
+        return detail::makeResult(tryMultiplyInteger(a, value, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryMultiply(I a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        return tryMultiply(b, a);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryDivide(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        detail::instrument(detail::Counter::Divisions);
+        if (b.numerator == 0 || a.denominator == 0) return FractionError::ZeroDivisor;
+        // reciprocal of b than multiply
+        result_type result;
+        return detail::makeResult(tryMultiplyFractions(a.numerator, a.denominator, b.denominator, b.numerator, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryDivide(const BasicFraction& a, I b) noexcept(traits_type::is_bounded) {
+        IntT value = 0;
+        if (!tryCheckedValue(b, value)) return FractionError::Overflow;
+        detail::instrument(detail::Counter::Divisions);
+        if (value == 0) return FractionError::ZeroDivisor;
+        result_type result;
+        return detail::makeResult(tryDivideByInteger(a, value, result), result);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr FractionResult<typename BasicFraction<IntT, OverflowPolicy>::result_type> BasicFraction<IntT, OverflowPolicy>::tryDivide(I a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        IntT value = 0;
+        if (!tryCheckedValue(a, value)) return FractionError::Overflow;
+        detail::instrument(detail::Counter::Divisions);
+        if (b.numerator == 0) return FractionError::ZeroDivisor;
+        result_type result;
+        return detail::makeResult(tryDivideInteger(value, b, result), result);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<BasicFraction<IntT, OverflowPolicy>> BasicFraction<IntT, OverflowPolicy>::tryMake(IntT n, IntT d, bool simplify) noexcept(traits_type::is_bounded) {
+        if (d == 0) return FractionError::ZeroDivisor;
+        if (!simplify && !is_normalized) return BasicFraction(n, d);
+        BasicFraction result;
+        if constexpr (traits_type::is_bounded) {
+            if (!reduceInto(n, d, result)) return FractionError::Overflow;
+        } else {
+            result = BasicFraction(n, d, true);
+        }
+        return result;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<BasicFraction<IntT, OverflowPolicy>> BasicFraction<IntT, OverflowPolicy>::tryParse(std::string_view text, bool simplify) noexcept(traits_type::is_bounded) {
+        BasicFraction parsed;
+        ParseResult result = parse(text, parsed, simplify);
+        if (result && detail::skipBlanks(text, result.consumed) != text.size()) {
+            result.error = ParseError::InvalidFormat; // trailing characters
+        }
+        return detail::makeResult(toFractionError(result.error), parsed);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionResult<BasicFraction<IntT, OverflowPolicy>> BasicFraction<IntT, OverflowPolicy>::tryReciprocal(const BasicFraction& frac) noexcept(traits_type::is_bounded) {
+        return tryMake(frac.denominator, frac.numerator);
+    }
+
+    // Status-returning cores. Overflow is only reported for raising policies; the others
+    // substitute through the policy inside the try* helpers.
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryAddFractions(const BasicFraction& x, const BasicFraction& y, bool subtract, result_type& out) noexcept(traits_type::is_bounded) {
+        if constexpr (cancels_first && !traits_type::is_bounded) {
+            addSplit(x.numerator, x.denominator, y.numerator, y.denominator, subtract, out);
+            if constexpr (is_normalized) detail::countReduction(false);
+            return FractionError::None;
+        } else if constexpr (cancels_first && OverflowPolicy::checked) {
+            // Full products when they fit; otherwise the split keeps the intermediates small
+            IntT left = 0, right = 0, n = 0, d = 0;
+            bool overflow = detail::mulOverflow(x.numerator, y.denominator, left) | detail::mulOverflow(y.numerator, x.denominator, right) |
+                (subtract ? detail::subOverflow(left, right, n) : detail::addOverflow(left, right, n)) |
+                detail::mulOverflow(x.denominator, y.denominator, d);
+            if (!overflow) return tryFromComponents(n, d, out);
+            if (addSplit(x.numerator, x.denominator, y.numerator, y.denominator, subtract, out)) {
+                if constexpr (is_normalized) detail::countReduction(false);
+                out.settle();
+                return FractionError::None;
+            }
+        }
+        // Exact in wide_type; tryFromComponents reduces results that do not fit before giving up
+        wide_type left = 0, right = 0, n = 0, d = 0;
+        if (!tryWideMul(x.numerator, y.denominator, left) || !tryWideMul(y.numerator, x.denominator, right) ||
+            !(subtract ? tryWideSub(left, right, n) : tryWideAdd(left, right, n)) || !tryWideMul(x.denominator, y.denominator, d)) {
+            return FractionError::Overflow;
+        }
+        return result_type::tryFromComponents(n, d, out);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryMultiplyFractions(IntT a, IntT b, IntT c, IntT d, result_type& out) noexcept(traits_type::is_bounded) {
+        if constexpr (cancels_first && !traits_type::is_bounded) {
+            multiplyCancelled(a, b, c, d, out);
+            if constexpr (is_normalized) detail::countReduction(false);
+            return FractionError::None;
+        } else if constexpr (cancels_first && OverflowPolicy::checked) {
+            IntT n = 0, q = 0;
+            if (!(detail::mulOverflow(a, c, n) | detail::mulOverflow(b, d, q))) return tryFromComponents(n, q, out);
+            if (multiplyCancelled(a, b, c, d, out)) {
+                if constexpr (is_normalized) detail::countReduction(false);
+                out.settle();
+                return FractionError::None;
+            }
+        }
+        wide_type n = 0, q = 0;
+        if (!tryWideMul(a, c, n) || !tryWideMul(b, d, q)) return FractionError::Overflow;
+        return result_type::tryFromComponents(n, q, out);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryAddInteger(const BasicFraction& frac, IntT value, bool subtract, result_type& out) noexcept(traits_type::is_bounded) {
+        wide_type scaled = 0, n = 0;
+        if (!tryWideMul(value, frac.denominator, scaled) ||
+            !(subtract ? tryWideSub(frac.numerator, scaled, n) : tryWideAdd(frac.numerator, scaled, n))) {
+            return FractionError::Overflow;
+        }
+        return result_type::tryFromComponents(n, wide_type(frac.denominator), out);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::trySubtractFromInteger(IntT value, const BasicFraction& frac, result_type& out) noexcept(traits_type::is_bounded) {
+        wide_type scaled = 0, n = 0;
+        if (!tryWideMul(value, frac.denominator, scaled) || !tryWideSub(scaled, frac.numerator, n)) return FractionError::Overflow;
+        return result_type::tryFromComponents(n, wide_type(frac.denominator), out);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryMultiplyInteger(const BasicFraction& frac, IntT value, result_type& out) noexcept(traits_type::is_bounded) {
+        wide_type n = 0;
+        if (!tryWideMul(frac.numerator, value, n)) return FractionError::Overflow;
+        return result_type::tryFromComponents(n, wide_type(frac.denominator), out);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryDivideByInteger(const BasicFraction& frac, IntT value, result_type& out) noexcept(traits_type::is_bounded) {
+        wide_type d = 0;
+        if (!tryWideMul(frac.denominator, value, d)) return FractionError::Overflow;
+        return result_type::tryFromComponents(wide_type(frac.numerator), d, out);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr FractionError BasicFraction<IntT, OverflowPolicy>::tryDivideInteger(IntT value, const BasicFraction& frac, result_type& out) noexcept(traits_type::is_bounded) {
+        wide_type n = 0;
+        if (!tryWideMul(value, frac.denominator, n)) return FractionError::Overflow;
+        return result_type::tryFromComponents(n, wide_type(frac.numerator), out);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Compound Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator+=(const BasicFraction& other) {
+        (*this) = BasicFraction(*(this) + other);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator+=(I value){
+        (*this) = BasicFraction(*(this) + value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator+=(double value){
+        (*this) = BasicFraction(*(this) + BasicFraction(value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator+=(const char* value){
+        (*this) = BasicFraction(*(this) + BasicFraction(value));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator-=(const BasicFraction& other){
+        (*this) = BasicFraction(*(this) - other);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator-=(I value){
+        (*this) = BasicFraction(*(this) - value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator-=(double value){
+        (*this) = BasicFraction(*(this) - BasicFraction(value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator-=(const char* value){
+        (*this) = BasicFraction(*(this) - BasicFraction(value));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator*=(const BasicFraction& other){
+        (*this) = BasicFraction(*(this) * other);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator*=(I value){
+        (*this) = BasicFraction(*(this) * value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator*=(double value){
+        (*this) = BasicFraction(*(this) * BasicFraction(value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator*=(const char* value){
+        (*this) = BasicFraction(*(this) * BasicFraction(value));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator/=(const BasicFraction& other){
+        (*this) = BasicFraction(*(this) / other);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    template <typename I, detail::EnableIfInteger<I>>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::operator/=(I value){
+        (*this) = BasicFraction(*(this) / value);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator/=(double value){
+        (*this) = BasicFraction(*(this) / BasicFraction(value));
+    }
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::operator/=(const char* value){
+        (*this) = BasicFraction(*(this) / BasicFraction(value));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Increment Decrement Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy>& BasicFraction<IntT, OverflowPolicy>::operator++(){
+        // A lazy value steps from its lowest terms, so 2/4 and 1/2 give the same result
+        if constexpr (is_lazy) simplify();
+        this->numerator = narrow(wideAdd(this->numerator, 1));
+        if constexpr (is_normalized) simplify();
+        this->setReducedFlag(false);
+        settle();
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy>& BasicFraction<IntT, OverflowPolicy>::operator--(){
+        // A lazy value steps from its lowest terms, so 2/4 and 1/2 give the same result
+        if constexpr (is_lazy) simplify();
+        this->numerator = narrow(wideSub(this->numerator, 1));
+        if constexpr (is_normalized) simplify();
+        this->setReducedFlag(false);
+        settle();
+        return *this;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::operator++(int){
+        BasicFraction temp = *this;
+        ++(*this);
+        return temp;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::operator--(int){
+        BasicFraction temp = *this;
+        --(*this);
+        return temp;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Unary Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::operator-() const {
+        // Handles negating numerator (+/-)
+        return fromWide(wideSub(0, this->numerator), this->denominator);
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Comparision Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    int BasicFraction<IntT, OverflowPolicy>::compareToDouble(const BasicFraction& frac, double value) {
+        BasicFraction other;
+        if constexpr (!traits_type::is_bounded) {
+            if (std::isinf(value)) return value > 0 ? -1 : 1;
+            other = BasicFraction(value); // Holds every double exactly
+        } else {
+            // The fraction the double converts to, as in the arithmetic operators. A double that
+            // has none is beyond every fraction of this type.
+            if (!detail::nearestDouble(value, other.numerator, other.denominator)) return value > 0 ? -1 : 1;
+        }
+        return compare(frac, other);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr int BasicFraction<IntT, OverflowPolicy>::compare(const BasicFraction& a, const BasicFraction& b) noexcept(traits_type::is_bounded) {
+        detail::instrument(detail::Counter::Comparisons);
+        if constexpr (traits_type::is_bounded && traits_type::has_wider) {
+            // One multiply per side is cheaper than branching on signs: components are at most
+            // 2^(bits - 1) in magnitude, so the cross products are exact in the wider type.
+            // Flip the result when exactly one denominator is negative.
+            wide_type left = static_cast<wide_type>(a.numerator) * b.denominator;
+            wide_type right = static_cast<wide_type>(b.numerator) * a.denominator;
+            int order = (left > right) - (left < right);
+            return ((a.denominator < 0) != (b.denominator < 0)) ? -order : order;
+        } else {
+            // Tier 1: signs, then equal denominators
+            int signA = (a.numerator > 0) - (a.numerator < 0);
+            int signB = (b.numerator > 0) - (b.numerator < 0);
+            if (a.denominator < 0) signA = -signA;
+            if (b.denominator < 0) signB = -signB;
+            if (signA != signB) return signA < signB ? -1 : 1;
+            if (signA == 0) return 0;
+            if (a.denominator == b.denominator) {
+                if (a.numerator == b.numerator) return 0;
+                return (a.numerator < b.numerator) == (a.denominator > 0) ? -1 : 1;
+            }
+
+            if constexpr (!traits_type::is_bounded) {
+                // Tier 2: the double approximations, when they are far enough apart
+                int filtered = detail::countedFilteredOrder(toDouble(a), toDouble(b));
+                if (filtered != 0) return filtered;
+
+                // Tier 3: exact cross products, oriented by the denominators' signs
+                IntT left = a.numerator * b.denominator;
+                IntT right = b.numerator * a.denominator;
+                if (left == right) return 0;
+                bool less = left < right;
+                if ((a.denominator < 0) != (b.denominator < 0)) less = !less;
+                return less ? -1 : 1;
+            } else {
+                // Tier 2: same-sign magnitudes, cross-multiplied when the products fit. This is
+                // cheaper than converting 128-bit components to double, so it goes first.
+                using U = detail::UnsignedOfT<IntT>;
+                U an = detail::magnitude(a.numerator);
+                U ad = detail::magnitude(a.denominator);
+                U bn = detail::magnitude(b.numerator);
+                U bd = detail::magnitude(b.denominator);
+                U left = 0, right = 0;
+                int order = 0;
+                if (!detail::mulOverflow(an, bd, left) && !detail::mulOverflow(bn, ad, right)) {
+                    order = (left > right) - (left < right);
+                } else {
+                    // Tier 3: the double approximations, then continued fractions, since the
+                    // widest type has nothing to widen into
+                    order = detail::countedFilteredOrder(toDouble(a), toDouble(b));
+                    if (order != 0) return order;
+                    order = detail::compareMagnitudes(an, ad, bn, bd);
+                }
+                return signA < 0 ? -order : order;
+            }
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::operator==(const BasicFraction& other) const {
+        if constexpr (is_normalized) {
+            // Canonical form: equal values have identical components
+            detail::instrument(detail::Counter::Comparisons);
+            return this->numerator == other.numerator && this->denominator == other.denominator;
+        } else {
+            if constexpr (is_lazy) {
+                if (this->knownReduced() && other.knownReduced()) {
+                    detail::instrument(detail::Counter::Comparisons);
+                    return this->numerator == other.numerator && this->denominator == other.denominator;
+                }
+            }
+            return compare(*this, other) == 0;
+        }
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator==(double other) const {
+        return !std::isnan(other) && compareToDouble(*this, other) == 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator==(const char* other) const {
+        return (*this == BasicFraction(other));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::operator!=(const BasicFraction& other) const {
+        return !(*this == other);  // implement != by negating ==
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator!=(double other) const {
+        return !(*this == other);
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator!=(const char* other) const {
+        return !(*this == BasicFraction(other));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::operator>=(const BasicFraction& other) const {
+        return compare(*this, other) >= 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator>=(double other) const {
+        return !std::isnan(other) && compareToDouble(*this, other) >= 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator>=(const char* other) const {
+        return (*this >= BasicFraction(other));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::operator<=(const BasicFraction& other) const {
+        return compare(*this, other) <= 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator<=(double other) const {
+        return !std::isnan(other) && compareToDouble(*this, other) <= 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator<=(const char* other) const {
+        return (*this <= BasicFraction(other));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::operator>(const BasicFraction& other) const {
+        return compare(*this, other) > 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator>(double other) const {
+        return !std::isnan(other) && compareToDouble(*this, other) > 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator>(const char* other) const {
+        return (*this > BasicFraction(other));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::operator<(const BasicFraction& other) const {
+        return compare(*this, other) < 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator<(double other) const {
+        return !std::isnan(other) && compareToDouble(*this, other) < 0;
+    }
+    template <typename IntT, typename OverflowPolicy>
+    bool BasicFraction<IntT, OverflowPolicy>::operator<(const char* other) const {
+        return (*this < BasicFraction(other));
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Misc Operators
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    std::ostream& BasicFraction<IntT, OverflowPolicy>::write(std::ostream& os) const {
+        if constexpr (traits_type::is_bounded) {
+            char buffer[maxFormattedChars<IntT>];
+            std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), *this);
+            os << std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer));
+        } else {
+            os << toString(*this);
+        }
+        return os;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    std::istream& BasicFraction<IntT, OverflowPolicy>::read(std::istream& is){
+        std::string input;
+
+        // Read the entire input
+        std::getline(is, input);
+
+        // Trim any leading/trailing whitespace
+        input.erase(input.find_last_not_of(" \t\n\r\f\v") + 1);
+        input.erase(0, input.find_first_not_of(" \t\n\r\f\v"));
+
+        // Check if the input is empty or invalid
+        if (input.empty() || (!std::isdigit(input[0]) && input[0] != '-')) {
+            is.setstate(std::ios::failbit);
+            detail::throwError(std::invalid_argument(
+                "Invalid format: use decimal (0.5, 1.2) or string fractions (1/2, 2 1/2)."));
+        }
+
+        // Attempt to parse as a double and convert to Fraction object
+        {
+            std::istringstream iss(input);
+            double value;
+
+            if (iss >> value && iss.eof()) { 
+                toFraction(value, DoubleConversion::Decimal); // typed decimals: "0.1" reads as 1/10
+                return is;
+            }
+        }
+
+        // Attempt to parse string and convert to Fraction object
+        BasicFraction parsed;
+        FractionError error = toFractionError(parseLeading(input, parsed).error);
+        if (error == FractionError::None) {
+            *this = parsed;
+            return is;
+        }
+        is.setstate(std::ios::failbit); // Mark stream as failed for invalid input
+        raiseIfError(error);
+        return is;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    BasicFraction<IntT, OverflowPolicy>& BasicFraction<IntT, OverflowPolicy>::operator=(const char* str){
+        assignString(str);
+        return *this;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    BasicFraction<IntT, OverflowPolicy>& BasicFraction<IntT, OverflowPolicy>::operator=(double decimal){
+        toFraction(decimal);
+        return *this;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Methods
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::toReciprocal(const BasicFraction& frac){
+        return unwrap(tryReciprocal(frac));
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::SimplifyFraction(BasicFraction& frac){
+        frac.simplify();
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::Simplify(BasicFraction frac){
+        frac.simplify();
+        return frac;
+    }
+    
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::Canonical(const BasicFraction& frac) noexcept(traits_type::is_bounded){
+        if (frac.knownReduced()) return frac;
+        if constexpr (traits_type::is_bounded) {
+            BasicFraction result;
+            if (frac.denominator != 0 && reduceInto(frac.numerator, frac.denominator, result)) return result;
+            return frac;
+        } else {
+            return Simplify(frac);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr bool BasicFraction<IntT, OverflowPolicy>::knownReduced() const noexcept {
+        if constexpr (is_normalized) {
+            return true;
+        } else {
+            return this->reducedFlag();
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::settle() noexcept(traits_type::is_bounded){
+        if constexpr (is_lazy) {
+            if (this->reducedFlag()) return;
+            constexpr std::size_t threshold = detail::lazyThresholdBits<OverflowPolicy, IntT>();
+            if constexpr (traits_type::is_bounded) {
+                if (static_cast<std::size_t>(detail::bitWidth(detail::magnitude(numerator) | detail::magnitude(denominator))) > threshold) {
+                    // Cannot throw: a value with no reduced form in IntT, like (min, -1), stays as it is
+                    reduceInto(numerator, denominator, *this);
+                    return;
+                }
+            } else {
+                if (numerator.bitWidth() > threshold || denominator.bitWidth() > threshold) {
+                    simplify();
+                    return;
+                }
+            }
+            detail::countReduction(true);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr void BasicFraction<IntT, OverflowPolicy>::simplify(){
+        detail::instrument(detail::Counter::SimplifyCalls);
+        if(denominator == 0) return; // quick fix for 0
+        if constexpr (is_lazy) {
+            if (this->reducedFlag()) return;
+        }
+
+        if constexpr (!traits_type::is_bounded) {
+            // Arbitrary precision: gcd() is the type's own (found by ADL), nothing can overflow
+            IntT g = gcd(numerator, denominator);
+            numerator /= g;
+            denominator /= g;
+            if (denominator < 0) {
+                numerator = -numerator;
+                denominator = -denominator;
+            }
+        } else {
+            // Reduce the magnitudes; gcd(0, d) = |d| so a zero numerator becomes 0/1
+            using U = detail::UnsignedOfT<IntT>;
+            U n = detail::magnitude(numerator);
+            U d = detail::magnitude(denominator);
+            U gcd = detail::gcdMagnitude(n, d);
+            n /= gcd;
+            d /= gcd;
+
+            // Ensure the denominator is always positive
+            bool negative = (numerator < 0) != (denominator < 0);
+            if (d > static_cast<U>(traits_type::max()) || (!negative && n > static_cast<U>(traits_type::max()))) {
+                detail::throwError(std::overflow_error(OVERFLOW_ERROR));
+            }
+            numerator = negative ? static_cast<IntT>(U(0) - n) : static_cast<IntT>(n);
+            denominator = static_cast<IntT>(d);
+        }
+        this->setReducedFlag(true);
+        if constexpr (is_normalized || is_lazy) detail::countReduction(false);
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    std::string BasicFraction<IntT, OverflowPolicy>::toString(const BasicFraction& frac){
+        if constexpr (traits_type::is_bounded) {
+            char buffer[maxFormattedChars<IntT>];
+            std::to_chars_result result = to_chars(buffer, buffer + sizeof(buffer), frac);
+            return std::string(buffer, result.ptr);
+        } else if constexpr (is_lazy) {
+            BasicFraction canonical = Canonical(frac);
+            return detail::integerToString(canonical.numerator) + "/" + detail::integerToString(canonical.denominator);
+        } else {
+            return detail::integerToString(frac.numerator) + "/" + detail::integerToString(frac.denominator);
+        }
+    }
+    
+    template <typename IntT, typename OverflowPolicy>
+    constexpr float BasicFraction<IntT, OverflowPolicy>::toFloat(const BasicFraction& frac){
+        detail::instrument(detail::Counter::ToDouble);
+        if constexpr (!traits_type::is_bounded) {
+            return static_cast<float>(toDouble(frac));
+        } else {
+            return (float)frac.numerator / (float)frac.denominator;
+        }
+    }
+    
+    template <typename IntT, typename OverflowPolicy>
+    constexpr double BasicFraction<IntT, OverflowPolicy>::toDouble(const BasicFraction& frac){
+        detail::instrument(detail::Counter::ToDouble);
+        if constexpr (!traits_type::is_bounded) {
+            // Components may be far outside double's range even when their ratio is not
+            return ratioToDouble(frac.numerator, frac.denominator);
+        } else {
+            return (double)frac.numerator / (double)frac.denominator;
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::fromDoubles(const double* values, std::size_t count, BasicFraction* out, DoubleConversion mode){
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i].toFraction(values[i], mode);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    template <typename M>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::fromMagnitudes(bool negative, M p, M q){
+        BasicFraction result;
+        if constexpr (traits_type::is_bounded) {
+            if (!detail::assignMagnitudes(negative, p, q, result.numerator, result.denominator)) {
+                detail::throwError(std::overflow_error(OVERFLOW_ERROR));
+            }
+        } else {
+            result.numerator = negative ? -p : p;
+            result.denominator = q;
+        }
+        return result;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::limitDenominator(const BasicFraction& value, IntT maxDenominator){
+        if (maxDenominator < 1) {
+            detail::throwError(std::invalid_argument(MAX_DENOMINATOR_ERROR));
+        }
+        bool negative = value.numerator != 0 && ((value.numerator < 0) != (value.denominator < 0));
+        if constexpr (traits_type::is_bounded) {
+            using U = detail::UnsignedOfT<IntT>;
+            U n = detail::magnitude(value.numerator);
+            U d = detail::magnitude(value.denominator);
+            if (d <= static_cast<U>(maxDenominator)) return Simplify(value);
+            U p = 0, q = 1;
+            detail::limitMagnitude<U>(n, d, static_cast<U>(maxDenominator), p, q);
+            return fromMagnitudes(negative, p, q);
+        } else {
+            IntT n = value.numerator < 0 ? -value.numerator : value.numerator;
+            IntT d = value.denominator < 0 ? -value.denominator : value.denominator;
+            if (d <= maxDenominator) return Simplify(value);
+            IntT p = 0, q = 1;
+            detail::limitMagnitude<IntT>(n, d, maxDenominator, p, q);
+            return fromMagnitudes(negative, p, q);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    BasicFraction<IntT, OverflowPolicy> BasicFraction<IntT, OverflowPolicy>::limitDenominator(double value, IntT maxDenominator){
+        if (maxDenominator < 1) {
+            detail::throwError(std::invalid_argument(MAX_DENOMINATOR_ERROR));
+        }
+        if (!std::isfinite(value)) {
+            detail::throwError(std::invalid_argument(NON_FINITE_ERROR));
+        }
+        if constexpr (traits_type::is_bounded) {
+            BasicFraction result;
+            if (!detail::limitDouble(value, static_cast<detail::UnsignedOfT<IntT>>(maxDenominator), result.numerator, result.denominator)) {
+                detail::throwError(std::overflow_error(OVERFLOW_ERROR));
+            }
+            return result;
+        } else {
+            return limitDenominator(BasicFraction(value), maxDenominator);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::limitDenominators(const double* values, std::size_t count, IntT maxDenominator, BasicFraction* out){
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = limitDenominator(values[i], maxDenominator);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::toFraction(double decimal, DoubleConversion mode){
+        detail::instrument(detail::Counter::FromDouble);
+        if (!std::isfinite(decimal)) {
+            detail::throwError(std::invalid_argument(NON_FINITE_ERROR));
+        }
+        this->setReducedFlag(false);
+        if (mode == DoubleConversion::Exact) {
+            toExactFraction(decimal);
+            this->setReducedFlag(true); // odd mantissa over a power of two, or an integer
+        } else {
+            toDecimalFraction(decimal);
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::toExactFraction(double value){
+        bool negative = false;
+        std::uint64_t mantissa = 0;
+        int exponent = 0;
+        detail::decomposeDouble(value, negative, mantissa, exponent);
+        if (mantissa == 0) {
+            numerator = 0;
+            denominator = 1;
+            return;
+        }
+
+        if constexpr (!traits_type::is_bounded) {
+            IntT m = static_cast<std::int64_t>(mantissa); // below 2^53
+            if (exponent >= 0) {
+                numerator = m << static_cast<std::size_t>(exponent);
+                denominator = 1;
+            } else {
+                numerator = m;
+                denominator = IntT(1) << static_cast<std::size_t>(-exponent);
+            }
+            if (negative) numerator = -numerator;
+        } else {
+            // The closest fraction that fits when the exact one does not (0.1 in 32 bits is 1/10)
+            if (!detail::nearestDouble(value, numerator, denominator)) {
+                detail::throwError(std::overflow_error(OVERFLOW_ERROR));
+            }
+        }
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::toDecimalFraction(double decimal){
+        // Save sign information and make decimal absolute value
+        bool negative = decimal < 0;
+        decimal = std::abs(decimal);
+
+        // Convert decimal to string to count decimal places
+        std::string decimalStr = std::to_string(decimal);
+        size_t decimalPointPos = decimalStr.find('.');
+        size_t decimalPlaces = decimalStr.size() - decimalPointPos - 1;
+
+        // Remove trailing zeros
+        while (decimalStr.back() == '0') {
+            decimalStr.pop_back();
+            decimalPlaces--;
+        }
+
+        // Build numerator and denominator, both must fit in IntT
+        double scale = std::pow(10, decimalPlaces);
+        double scaled = decimal * scale + 0.5; // Rounding
+        if constexpr (traits_type::is_bounded) {
+            if (scale > static_cast<double>(traits_type::max()) || scaled > static_cast<double>(traits_type::max())) {
+                detail::throwError(std::overflow_error(OVERFLOW_ERROR));
+            }
+        }
+        denominator = static_cast<IntT>(scale);
+        numerator = static_cast<IntT>(scaled);
+        if (negative) numerator = -numerator;
+
+        if(denominator == 0){
+            detail::throwError(std::invalid_argument(ZERO_DIVISOR_ERROR));
+        }
+        
+        // Required
+        simplify();
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Formatting and Parsing
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename IntT, typename OverflowPolicy>
+    std::to_chars_result to_chars(char* first, char* last, const BasicFraction<IntT, OverflowPolicy>& value, FractionFormat format)
+        noexcept(FractionTraits<IntT>::is_bounded) {
+        char* end;
+        if constexpr (BasicFraction<IntT, OverflowPolicy>::is_lazy) {
+            // A lazy value's components depend on when it was last reduced; print the value
+            BasicFraction<IntT, OverflowPolicy> canonical = BasicFraction<IntT, OverflowPolicy>::Canonical(value);
+            if constexpr (FractionTraits<IntT>::is_bounded) {
+                end = detail::formatComponents(first, last, canonical.numerator, canonical.denominator, format);
+            } else {
+                end = detail::formatUnbounded(first, last, canonical.numerator, canonical.denominator, format);
+            }
+        } else if constexpr (FractionTraits<IntT>::is_bounded) {
+            end = detail::formatComponents(first, last, value.numerator, value.denominator, format);
+        } else {
+            end = detail::formatUnbounded(first, last, value.numerator, value.denominator, format);
+        }
+        if (end == nullptr) return { last, std::errc::value_too_large };
+        return { end, std::errc() };
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    BatchFormatResult to_chars(char* first, char* last, const BasicFraction<IntT, OverflowPolicy>* values, std::size_t count,
+        FractionFormat format, char separator) noexcept(FractionTraits<IntT>::is_bounded) {
+        char* p = first;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::to_chars_result result = to_chars(p, last, values[i], format);
+            if (result.ec != std::errc() || result.ptr == last) return { p, std::errc::value_too_large, i };
+            *result.ptr = separator;
+            p = result.ptr + 1;
+        }
+        return { p, std::errc(), count };
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr ParseResult BasicFraction<IntT, OverflowPolicy>::parse(std::string_view text, BasicFraction& out, bool simplify)
+        noexcept(traits_type::is_bounded) {
+        IntT n = 0, d = 1;
+        ParseResult result = detail::parseComponents(text, n, d);
+        detail::instrument(detail::Counter::ParseCalls);
+        if (result) {
+            detail::instrument(detail::Counter::ParsedBytes, result.consumed);
+            out.numerator = n;
+            out.denominator = d;
+            out.setReducedFlag(d == 1);
+            // Cannot throw: d is positive and n was range-checked by the parser
+            if (simplify || is_normalized) out.simplify();
+        }
+        return result;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    constexpr ParseResult BasicFraction<IntT, OverflowPolicy>::parseLeading(std::string_view text, BasicFraction& out, bool simplify)
+        noexcept(traits_type::is_bounded) {
+        BasicFraction parsed;
+        ParseResult result = parse(text, parsed, simplify);
+        if (!result) return result;
+        // A whole number must end the text: "3 1" and "3 1/" are truncated mixed numbers, not 3
+        if (text.substr(0, result.consumed).find('/') == std::string_view::npos &&
+            detail::skipBlanks(text, result.consumed) != text.size()) {
+            return { ParseError::InvalidFormat, 0 };
+        }
+        out = parsed;
+        return result;
+    }
+
+    template <typename IntT, typename OverflowPolicy>
+    void BasicFraction<IntT, OverflowPolicy>::assignString(std::string_view text, bool simplify) {
+        BasicFraction parsed;
+        raiseIfError(toFractionError(parseLeading(text, parsed, simplify).error));
+        *this = parsed;
+    }
+}
@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*  fraction_loader.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "fraction.h"
+#include "mapped_file.h"
+#include "thread_pool.h"
+
+namespace FracLib {
+    /// @brief A field the loader could not parse.
+    struct LoadError {
+        std::size_t line;   ///< 1-based line number.
+        std::size_t offset; ///< Byte offset of the field from the start of the input.
+        ParseError error;
+        std::string text;   ///< The field, without surrounding blanks.
+    };
+
+    /// @brief Throughput of one load.
+    struct LoadStats {
+        std::size_t bytes = 0;
+        std::size_t values = 0;
+        std::size_t errors = 0;
+        std::size_t chunks = 0;
+        double seconds = 0.0; ///< Wall time, including mapping the file.
+
+        double valuesPerSecond() const noexcept { return seconds > 0.0 ? static_cast<double>(values) / seconds : 0.0; }
+        double gigabytesPerSecond() const noexcept { return seconds > 0.0 ? static_cast<double>(bytes) / seconds / 1e9 : 0.0; }
+    };
+
+    template <typename FractionT>
+    struct LoadResult {
+        std::vector<FractionT> values; ///< In input order.
+        std::vector<LoadError> errors; ///< In input order.
+        LoadStats stats;
+    };
+
+    struct LoadOptions {
+        /// @brief Pool to parse on. nullptr uses ThreadPool::shared().
+        ThreadPool* pool = nullptr;
+        /// @brief Approximate bytes per parallel task. Chunks end at a field separator.
+        std::size_t chunkBytes = std::size_t(1) << 20;
+        /// @brief Simplify every value as it is parsed.
+        bool simplify = false;
+    };
+
+    namespace detail {
+        constexpr bool isFieldSeparator(char c) noexcept { return c == '\n' || c == ','; }
+
+        /// @brief Field and line counts of one chunk, gathered before parsing so every chunk
+        /// knows where its values and line numbers start.
+        struct ChunkInfo {
+            std::size_t begin = 0;
+            std::size_t end = 0;
+            std::size_t maxValues = 0;   // separators + 1, an upper bound on the values
+            std::size_t newlines = 0;
+            std::size_t valueBegin = 0;  // first output slot
+            std::size_t firstLine = 0;
+            std::size_t parsed = 0;
+            std::vector<LoadError> errors;
+        };
+
+        /// @brief Splits `[0, size)` into chunks of about `chunkBytes` that end just after a
+        /// field separator (or at the end of the input), so no field spans two chunks.
+        inline std::vector<ChunkInfo> splitChunks(std::string_view data, std::size_t chunkBytes) {
+            std::vector<ChunkInfo> chunks;
+            chunkBytes = std::max<std::size_t>(chunkBytes, 1);
+            std::size_t begin = 0;
+            while (begin < data.size()) {
+                std::size_t end = std::min(data.size(), begin + chunkBytes);
+                while (end < data.size() && !isFieldSeparator(data[end - 1])) ++end;
+                ChunkInfo chunk;
+                chunk.begin = begin;
+                chunk.end = end;
+                chunks.push_back(std::move(chunk));
+                begin = end;
+            }
+            return chunks;
+        }
+
+        inline void countChunk(std::string_view data, ChunkInfo& chunk) noexcept {
+            std::size_t separators = 0, newlines = 0;
+            for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+                separators += isFieldSeparator(data[i]);
+                newlines += data[i] == '\n';
+            }
+            chunk.maxValues = separators + 1;
+            chunk.newlines = newlines;
+        }
+
+        /// @brief Parses the fields of one chunk into `out`, which has room for `maxValues`.
+        /// Blank fields are skipped; anything else that is not a whole fraction is recorded.
+        template <typename FractionT>
+        void parseChunk(std::string_view data, ChunkInfo& chunk, FractionT* out, bool simplify) {
+            std::size_t line = chunk.firstLine;
+            std::size_t pos = chunk.begin;
+            while (pos < chunk.end) {
+                std::size_t fieldEnd = pos;
+                while (fieldEnd < chunk.end && !isFieldSeparator(data[fieldEnd])) ++fieldEnd;
+
+                std::size_t first = skipBlanks(data, pos);
+                std::size_t last = fieldEnd;
+                while (last > first && (isBlank(data[last - 1]) || data[last - 1] == '\r')) --last;
+
+                if (first < last) {
+                    std::string_view field = data.substr(first, last - first);
+                    ParseResult result = FractionT::parse(field, out[chunk.parsed], simplify);
+                    if (result && result.consumed != field.size()) result.error = ParseError::InvalidFormat;
+                    if (result) {
+                        ++chunk.parsed;
+                    } else {
+                        chunk.errors.push_back(LoadError{ line, first, result.error, std::string(field) });
+                    }
+                }
+
+                if (fieldEnd < chunk.end && data[fieldEnd] == '\n') ++line;
+                pos = fieldEnd + 1;
+            }
+        }
+    }
+
+    /// @brief Parses every fraction in `data`, one per line and/or separated by commas, on a
+    /// thread pool. Fields use the `BasicFraction::parse` forms ("n", "n/d", "w n/d"); blank
+    /// fields are skipped and malformed ones are reported in `errors` instead of throwing.
+    /// Values are written straight into one contiguous buffer, in input order.
+    template <typename FractionT>
+    LoadResult<FractionT> parseFractions(std::string_view data, const LoadOptions& options = LoadOptions()) {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        ThreadPool& pool = options.pool ? *options.pool : ThreadPool::shared();
+
+        LoadResult<FractionT> result;
+        std::vector<detail::ChunkInfo> chunks = detail::splitChunks(data, options.chunkBytes);
+
+        // Pass 1: count separators so each chunk gets its own slots in the output
+        pool.parallelFor(chunks.size(), [&](std::size_t i) { detail::countChunk(data, chunks[i]); });
+        std::size_t capacity = 0, line = 1;
+        for (detail::ChunkInfo& chunk : chunks) {
+            chunk.valueBegin = capacity;
+            chunk.firstLine = line;
+            capacity += chunk.maxValues;
+            line += chunk.newlines;
+        }
+        result.values.resize(capacity);
+
+        // Pass 2: parse in place
+        FractionT* out = result.values.data();
+        pool.parallelFor(chunks.size(), [&](std::size_t i) {
+            detail::parseChunk(data, chunks[i], out + chunks[i].valueBegin, options.simplify);
+        });
+
+        // Close the gaps left by blank and rejected fields
+        std::size_t size = 0;
+        for (detail::ChunkInfo& chunk : chunks) {
+            if (chunk.valueBegin != size) {
+                std::move(out + chunk.valueBegin, out + chunk.valueBegin + chunk.parsed, out + size);
+            }
+            size += chunk.parsed;
+            result.errors.insert(result.errors.end(), std::make_move_iterator(chunk.errors.begin()),
+                std::make_move_iterator(chunk.errors.end()));
+        }
+        result.values.resize(size);
+
+        result.stats.bytes = data.size();
+        result.stats.values = size;
+        result.stats.errors = result.errors.size();
+        result.stats.chunks = chunks.size();
+        result.stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return result;
+    }
+
+    /// @brief Memory-maps `path` and parses it with `parseFractions`.
+    /// @throws std::system_error If the file cannot be opened or mapped.
+    /// @example auto loaded = FracLib::loadFractions<Fraction64>("values.txt");
+    template <typename FractionT>
+    LoadResult<FractionT> loadFractions(const std::string& path, const LoadOptions& options = LoadOptions()) {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        MappedFile file(path);
+        LoadResult<FractionT> result = parseFractions<FractionT>(file.view(), options);
+        result.stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return result;
+    }
+}
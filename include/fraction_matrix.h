@@ -0,0 +1,249 @@
+/**************************************************************************/
+/*  fraction_matrix.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+#include "fraction.h"
+#include "bigint.h"
+#include "thread_pool.h"
+
+namespace FracLib {
+    /// @brief A dense, row-major matrix of fractions, for the exact linear algebra below
+    /// (`determinant`, `solve`, `inverse`).
+    /// @example RationalMatrix<Fraction32> m(2, 2, {1, 2, 3, 4});
+    template <typename FractionT>
+    class RationalMatrix {
+    public:
+        using fraction_type = FractionT;
+
+        static constexpr const char* DIMENSION_ERROR = "Matrix dimensions do not match.";
+        static constexpr const char* SINGULAR_ERROR = "Matrix is singular.";
+
+    public: // CONSTRUCTORS
+        /// @brief An empty (0 x 0) matrix.
+        RationalMatrix() = default;
+        /// @brief A rows x cols matrix of zeros.
+        RationalMatrix(std::size_t rows, std::size_t cols) : rows_(rows), cols_(cols), values_(rows * cols) {}
+        /// @brief A rows x cols matrix with `values` in row-major order.
+        /// @throws std::invalid_argument If `values` does not hold rows * cols entries.
+        RationalMatrix(std::size_t rows, std::size_t cols, std::initializer_list<FractionT> values);
+        /// @brief The n x n identity matrix.
+        static RationalMatrix identity(std::size_t n);
+
+    public: // OPERATORS
+        FractionT& operator()(std::size_t row, std::size_t col) { return values_[row * cols_ + col]; }
+        const FractionT& operator()(std::size_t row, std::size_t col) const { return values_[row * cols_ + col]; }
+        /// @brief Same dimensions and equal values (not necessarily equal representations).
+        friend bool operator==(const RationalMatrix& a, const RationalMatrix& b) { return a.rows_ == b.rows_ && a.cols_ == b.cols_ && a.values_ == b.values_; }
+        friend bool operator!=(const RationalMatrix& a, const RationalMatrix& b) { return !(a == b); }
+
+    public: // METHODS
+        std::size_t rows() const noexcept { return rows_; }
+        std::size_t cols() const noexcept { return cols_; }
+        bool isSquare() const noexcept { return rows_ == cols_; }
+        /// @brief The entries in row-major order.
+        FractionT* data() noexcept { return values_.data(); }
+        const FractionT* data() const noexcept { return values_.data(); }
+
+    private:
+        std::size_t rows_ = 0;
+        std::size_t cols_ = 0;
+        std::vector<FractionT> values_;
+    };
+
+    /// @brief Exact determinant of a square matrix, by Bareiss elimination over the integers
+    /// and a single division at the end.
+    /// @param pool Threads to eliminate on; nullptr uses ThreadPool::shared(). Small matrices
+    /// run on the calling thread.
+    /// @throws std::invalid_argument If `a` is not square.
+    /// @throws std::overflow_error If the result does not fit and the policy throws.
+    template <typename FractionT>
+    FractionT determinant(const RationalMatrix<FractionT>& a, ThreadPool* pool = nullptr);
+    /// @brief Exact solution X of A X = B, by fraction-free Gauss-Jordan elimination over the
+    /// integers: the square part ends as det * I, so each entry of X takes one division.
+    /// @throws std::invalid_argument If `a` is not square, `b` has a different number of rows,
+    /// or `a` is singular.
+    /// @throws std::overflow_error If an entry does not fit and the policy throws.
+    template <typename FractionT>
+    RationalMatrix<FractionT> solve(const RationalMatrix<FractionT>& a, const RationalMatrix<FractionT>& b, ThreadPool* pool = nullptr);
+    /// @brief Exact solution x of A x = b.
+    template <typename FractionT>
+    std::vector<FractionT> solve(const RationalMatrix<FractionT>& a, const std::vector<FractionT>& b, ThreadPool* pool = nullptr);
+    /// @brief Exact inverse, solving A X = I.
+    /// @throws std::invalid_argument If `a` is not square or is singular.
+    template <typename FractionT>
+    RationalMatrix<FractionT> inverse(const RationalMatrix<FractionT>& a, ThreadPool* pool = nullptr);
+
+    namespace detail {
+        /// @brief A system [A | B] over the integers, row-major: each row of the rational system
+        /// multiplied by the least common multiple of its denominators. The first `rows`
+        /// columns hold A, the rest B.
+        struct IntegerSystem {
+            std::size_t rows = 0;
+            std::size_t cols = 0;
+            std::vector<BigInt> values;
+        };
+
+        /// @brief Columns of the pivot row a task applies to all of its rows before moving on,
+        /// so that stretch of the pivot row stays in cache.
+        inline constexpr std::size_t bareissBlockColumns = 256;
+        /// @brief Entries an elimination step updates below which it runs on the calling thread.
+        inline constexpr std::size_t bareissParallelCells = std::size_t(1) << 14;
+
+        /// @brief Bareiss elimination of the square part of `system`, in place. Each step
+        /// divides exactly by the previous pivot, so every entry stays an integer: a minor of
+        /// the input, bounded by Hadamard's inequality. The elimination runs in int64_t or
+        /// int128_t when that bound allows and in BigInt otherwise. Rows are updated in
+        /// parallel on `pool`. With `jordan` the rows above each pivot are eliminated too,
+        /// which leaves det * I in the square part and det * A^-1 B beside it; otherwise the
+        /// last pivot is the determinant.
+        /// @param negated Set when the rows were swapped an odd number of times.
+        /// @return false if the square part is singular.
+        bool bareissEliminate(IntegerSystem& system, bool jordan, ThreadPool& pool, bool& negated);
+
+        /// @brief Scales each row of [a | b] (`b` may be null) to integers.
+        /// @param scale If not null, receives the product of the row multipliers.
+        template <typename FractionT>
+        IntegerSystem integerSystem(const RationalMatrix<FractionT>& a, const RationalMatrix<FractionT>* b, BigInt* scale) {
+            IntegerSystem system;
+            system.rows = a.rows();
+            system.cols = a.cols() + (b ? b->cols() : 0);
+            system.values.resize(system.rows * system.cols);
+            if (scale) *scale = 1;
+            std::vector<const FractionT*> entries(system.cols);
+            for (std::size_t r = 0; r < system.rows; ++r) {
+                for (std::size_t c = 0; c < a.cols(); ++c) entries[c] = &a(r, c);
+                for (std::size_t c = a.cols(); c < system.cols; ++c) entries[c] = &(*b)(r, c - a.cols());
+                BigInt multiple = 1;
+                for (const FractionT* entry : entries) {
+                    BigInt d(entry->denominator);
+                    if (d == 1 || entry->numerator == 0) continue;
+                    if (d.isNegative()) d = -d;
+                    multiple = multiple / gcd(multiple, d) * d;
+                }
+                BigInt* row = system.values.data() + r * system.cols;
+                for (std::size_t c = 0; c < system.cols; ++c) {
+                    if (entries[c]->numerator == 0) continue;
+                    row[c] = BigInt(entries[c]->numerator) * (multiple / BigInt(entries[c]->denominator));
+                }
+                if (scale) *scale *= multiple;
+            }
+            return system;
+        }
+
+        /// @brief Runs fraction-free Gauss-Jordan on [a | b] and divides the right-hand side by
+        /// the common diagonal.
+        template <typename FractionT>
+        RationalMatrix<FractionT> solveSystem(const RationalMatrix<FractionT>& a, const RationalMatrix<FractionT>& b, ThreadPool* pool) {
+            if (!a.isSquare() || b.rows() != a.rows()) {
+                detail::throwError(std::invalid_argument(RationalMatrix<FractionT>::DIMENSION_ERROR));
+            }
+            IntegerSystem system = integerSystem(a, &b, nullptr);
+            bool negated = false;
+            if (!bareissEliminate(system, true, pool ? *pool : ThreadPool::shared(), negated)) {
+                detail::throwError(std::invalid_argument(RationalMatrix<FractionT>::SINGULAR_ERROR));
+            }
+            RationalMatrix<FractionT> x(b.rows(), b.cols());
+            if (a.rows() == 0) return x;
+            const BigInt& diagonal = system.values[(system.rows - 1) * system.cols + system.rows - 1];
+            for (std::size_t r = 0; r < x.rows(); ++r) {
+                for (std::size_t c = 0; c < x.cols(); ++c) {
+                    x(r, c) = narrowBigFraction<FractionT>(system.values[r * system.cols + a.cols() + c], diagonal);
+                }
+            }
+            return x;
+        }
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Constructors
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    RationalMatrix<FractionT>::RationalMatrix(std::size_t rows, std::size_t cols, std::initializer_list<FractionT> values)
+        : rows_(rows), cols_(cols), values_(values) {
+        if (values_.size() != rows * cols) {
+            detail::throwError(std::invalid_argument(DIMENSION_ERROR));
+        }
+    }
+
+    template <typename FractionT>
+    RationalMatrix<FractionT> RationalMatrix<FractionT>::identity(std::size_t n) {
+        RationalMatrix result(n, n);
+        for (std::size_t i = 0; i < n; ++i) result(i, i) = FractionT(1);
+        return result;
+    }
+
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Linear Algebra
+    //\\\\\\\\\\\\\\\\\\\\/
+    template <typename FractionT>
+    FractionT determinant(const RationalMatrix<FractionT>& a, ThreadPool* pool) {
+        if (!a.isSquare()) {
+            detail::throwError(std::invalid_argument(RationalMatrix<FractionT>::DIMENSION_ERROR));
+        }
+        if (a.rows() == 0) return FractionT(1);
+        BigInt scale;
+        detail::IntegerSystem system = detail::integerSystem<FractionT>(a, nullptr, &scale);
+        bool negated = false;
+        if (!detail::bareissEliminate(system, false, pool ? *pool : ThreadPool::shared(), negated)) return FractionT(0);
+        BigInt det = system.values.back();
+        if (negated) det = -det;
+        return detail::narrowBigFraction<FractionT>(std::move(det), std::move(scale));
+    }
+
+    template <typename FractionT>
+    RationalMatrix<FractionT> solve(const RationalMatrix<FractionT>& a, const RationalMatrix<FractionT>& b, ThreadPool* pool) {
+        return detail::solveSystem(a, b, pool);
+    }
+
+    template <typename FractionT>
+    std::vector<FractionT> solve(const RationalMatrix<FractionT>& a, const std::vector<FractionT>& b, ThreadPool* pool) {
+        RationalMatrix<FractionT> column(b.size(), 1);
+        for (std::size_t i = 0; i < b.size(); ++i) column(i, 0) = b[i];
+        RationalMatrix<FractionT> x = detail::solveSystem(a, column, pool);
+        return std::vector<FractionT>(x.data(), x.data() + x.rows());
+    }
+
+    template <typename FractionT>
+    RationalMatrix<FractionT> inverse(const RationalMatrix<FractionT>& a, ThreadPool* pool) {
+        if (!a.isSquare()) {
+            detail::throwError(std::invalid_argument(RationalMatrix<FractionT>::DIMENSION_ERROR));
+        }
+        return detail::solveSystem(a, RationalMatrix<FractionT>::identity(a.rows()), pool);
+    }
+}
+
+#ifdef FRACLIB_HEADER_ONLY
+#include "fraction_matrix_impl.h"
+#endif
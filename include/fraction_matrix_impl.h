@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  fraction_matrix_impl.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+// Out-of-line definitions for the Bareiss elimination behind fraction_matrix.h. Compiled by
+// src/fraction_matrix.cpp, or included by fraction_matrix.h in header-only mode; do not
+// include directly.
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace FracLib {
+    namespace detail {
+        /// @brief The elimination itself, on a row-major rows x cols matrix of T. T must hold
+        /// every product of two entries, see bareissEliminate.
+        template <typename T>
+        bool bareissRows(T* m, std::size_t rows, std::size_t cols, bool jordan, ThreadPool& pool, bool& negated) {
+            T previous(1);
+            negated = false;
+            for (std::size_t k = 0; k < rows; ++k) {
+                T* pivotRow = m + k * cols;
+                if (pivotRow[k] == 0) {
+                    // Rows from k on are zero left of column k, so only the rest needs swapping
+                    std::size_t r = k + 1;
+                    while (r < rows && m[r * cols + k] == 0) ++r;
+                    if (r == rows) return false;
+                    std::swap_ranges(pivotRow + k, pivotRow + cols, m + r * cols + k);
+                    negated = !negated;
+                }
+                const T pivot = pivotRow[k];
+                // Rows to update: those below the pivot, and with `jordan` those above it
+                std::size_t first = jordan ? 0 : k + 1;
+                std::size_t count = rows - first - (jordan ? 1 : 0);
+                std::size_t tasks = 1;
+                if (pool.size() > 1 && count * (cols - k) >= bareissParallelCells) tasks = std::min(count, pool.size() * 4);
+                auto rowIndex = [&](std::size_t index) { return first + index + (jordan && first + index >= k ? 1 : 0); };
+                auto update = [&](std::size_t task) {
+                    std::size_t begin = count * task / tasks;
+                    std::size_t end = count * (task + 1) / tasks;
+                    for (std::size_t block = k + 1; block < cols; block += bareissBlockColumns) {
+                        std::size_t blockEnd = std::min(cols, block + bareissBlockColumns);
+                        for (std::size_t index = begin; index < end; ++index) {
+                            T* row = m + rowIndex(index) * cols;
+                            const T& factor = row[k];
+                            for (std::size_t j = block; j < blockEnd; ++j) {
+                                row[j] = (pivot * row[j] - factor * pivotRow[j]) / previous;
+                            }
+                        }
+                    }
+                    for (std::size_t index = begin; index < end; ++index) {
+                        std::size_t i = rowIndex(index);
+                        m[i * cols + k] = 0;
+                        // An earlier pivot becomes this one: (pivot * previous - factor * 0) / previous
+                        if (i < k) m[i * cols + i] = pivot;
+                    }
+                };
+                if (tasks == 1) {
+                    update(0);
+                } else {
+                    pool.parallelFor(tasks, update);
+                }
+                previous = pivot;
+            }
+            return true;
+        }
+
+        /// @brief log2 of Hadamard's bound on the minors of `system`: the product of its row
+        /// norms, each at most sqrt(cols) times the row's largest entry.
+        FRACLIB_INLINE double hadamardBits(const IntegerSystem& system) {
+            double rowScale = 0.5 * std::log2(static_cast<double>(system.cols));
+            double bits = 0;
+            for (std::size_t r = 0; r < system.rows; ++r) {
+                std::size_t widest = 0;
+                for (std::size_t c = 0; c < system.cols; ++c) widest = std::max(widest, system.values[r * system.cols + c].bitWidth());
+                // A zero row makes every minor through it zero
+                if (widest != 0) bits += static_cast<double>(widest) + rowScale;
+            }
+            return bits;
+        }
+
+        template <typename T>
+        bool bareissNarrow(IntegerSystem& system, bool jordan, ThreadPool& pool, bool& negated) {
+            std::vector<T> m(system.values.size());
+            for (std::size_t i = 0; i < m.size(); ++i) system.values[i].tryConvert(m[i]);
+            bool regular = bareissRows(m.data(), system.rows, system.cols, jordan, pool, negated);
+            for (std::size_t i = 0; i < m.size(); ++i) system.values[i] = BigInt(m[i]);
+            return regular;
+        }
+
+        FRACLIB_INLINE bool bareissEliminate(IntegerSystem& system, bool jordan, ThreadPool& pool, bool& negated) {
+            // Every entry (and pivot) is a minor, below 2^bound; an update subtracts two
+            // products of them before dividing
+            double bound = std::ceil(hadamardBits(system) + 1e-6);
+            double needed = 2 * bound + 2;
+            if (needed <= 64) return bareissNarrow<std::int64_t>(system, jordan, pool, negated);
+#ifdef FRACLIB_HAS_INT128
+            if (needed <= 128) return bareissNarrow<int128_t>(system, jordan, pool, negated);
+#endif
+            return bareissRows(system.values.data(), system.rows, system.cols, jordan, pool, negated);
+        }
+    }
+}
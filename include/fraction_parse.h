@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*  fraction_parse.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "fraction_traits.h"
+
+namespace FracLib {
+    /// @brief Why a parse failed. `None` on success.
+    enum class ParseError : std::uint8_t {
+        None,
+        InvalidFormat,
+        ZeroDenominator,
+        Overflow
+    };
+
+    /// @brief Outcome of `BasicFraction::parse`.
+    /// `consumed` counts the characters read, including leading blanks, so the caller can keep
+    /// scanning after the fraction. Nothing is consumed on `InvalidFormat`; on `ZeroDenominator`
+    /// and `Overflow` it spans the rejected fraction.
+    struct ParseResult {
+        ParseError error;
+        std::size_t consumed;
+
+        constexpr explicit operator bool() const noexcept { return error == ParseError::None; }
+    };
+
+    namespace detail {
+        constexpr bool isDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+        constexpr bool isBlank(char c) noexcept { return c == ' ' || c == '\t'; }
+
+        /// @brief Index of the first non-blank character at or after `pos`.
+        constexpr std::size_t skipBlanks(std::string_view text, std::size_t pos) noexcept {
+            while (pos < text.size() && isBlank(text[pos])) ++pos;
+            return pos;
+        }
+        /// @brief Index one past the run of digits starting at `pos`.
+        constexpr std::size_t skipDigits(std::string_view text, std::size_t pos) noexcept {
+            while (pos < text.size() && isDigit(text[pos])) ++pos;
+            return pos;
+        }
+
+        /// @brief Accumulates the digits in `[first, last)` into `value`. Negative values are
+        /// built by subtraction so the most negative `IntT` parses.
+        /// @return true if the value does not fit in `IntT`.
+        template <typename IntT>
+        constexpr bool accumulateDigits(std::string_view text, std::size_t first, std::size_t last, bool negative, IntT& value)
+            noexcept(FractionTraits<IntT>::is_bounded) {
+            value = 0;
+            for (std::size_t i = first; i < last; ++i) {
+                IntT digit = static_cast<IntT>(text[i] - '0');
+                if (mulOverflow(value, static_cast<IntT>(10), value)) return true;
+                if (negative ? subOverflow(value, digit, value) : addOverflow(value, digit, value)) return true;
+            }
+            return false;
+        }
+
+        /// @brief Parses "n", "n/d" or "w n/d", optionally preceded by blanks and a '-', into
+        /// unreduced components. Stops at the first character that cannot continue the fraction;
+        /// "w n/d" is only taken when all of it is present, otherwise "w" stands alone.
+        /// Never allocates for built-in `IntT`.
+        template <typename IntT>
+        constexpr ParseResult parseComponents(std::string_view text, IntT& numerator, IntT& denominator)
+            noexcept(FractionTraits<IntT>::is_bounded) {
+            std::size_t pos = skipBlanks(text, 0);
+            bool negative = false;
+            if (pos < text.size() && text[pos] == '-') {
+                negative = true;
+                ++pos;
+            }
+
+            std::size_t firstEnd = skipDigits(text, pos);
+            if (firstEnd == pos) return { ParseError::InvalidFormat, 0 };
+
+            // Digit runs: [wholeFirst, wholeLast) only for mixed numbers
+            std::size_t wholeFirst = pos, wholeLast = pos;
+            std::size_t numFirst = pos, numLast = firstEnd;
+            std::size_t denFirst = firstEnd, denLast = firstEnd;
+            std::size_t end = firstEnd;
+
+            if (end < text.size() && text[end] == '/') {
+                denFirst = end + 1;
+                denLast = skipDigits(text, denFirst);
+                if (denLast == denFirst) return { ParseError::InvalidFormat, 0 };
+                end = denLast;
+            } else if (end < text.size() && isBlank(text[end])) {
+                std::size_t a = skipBlanks(text, end);
+                std::size_t aEnd = skipDigits(text, a);
+                if (aEnd > a && aEnd < text.size() && text[aEnd] == '/') {
+                    std::size_t bEnd = skipDigits(text, aEnd + 1);
+                    if (bEnd > aEnd + 1) {
+                        wholeLast = firstEnd;
+                        numFirst = a;
+                        numLast = aEnd;
+                        denFirst = aEnd + 1;
+                        denLast = bEnd;
+                        end = bEnd;
+                    }
+                }
+            }
+
+            bool mixed = wholeLast != wholeFirst;
+            IntT num = 0, den = 1;
+            if (accumulateDigits(text, numFirst, numLast, negative && !mixed, num)) return { ParseError::Overflow, end };
+            if (denLast != denFirst) {
+                if (accumulateDigits(text, denFirst, denLast, false, den)) return { ParseError::Overflow, end };
+                if (den == 0) return { ParseError::ZeroDenominator, end };
+            }
+            if (mixed) {
+                // -(w + n/d) = (-w * d - n) / d
+                IntT whole = 0;
+                if (accumulateDigits(text, wholeFirst, wholeLast, negative, whole) ||
+                    mulOverflow(whole, den, whole) ||
+                    (negative ? subOverflow(whole, num, num) : addOverflow(whole, num, num))) {
+                    return { ParseError::Overflow, end };
+                }
+            }
+
+            numerator = num;
+            denominator = den;
+            return { ParseError::None, end };
+        }
+    }
+}
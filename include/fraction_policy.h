@@ -0,0 +1,313 @@
+/**************************************************************************/
+/*  fraction_policy.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <stdexcept>
+#include "fraction_traits.h"
+#include "fraction_gcd.h"
+
+namespace FracLib {
+    namespace detail {
+        inline constexpr const char* overflowErrorMessage = "Integer overflow detected.";
+
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Policy-checked arithmetic
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Unchecked policies wrap (the builtins never invoke undefined behaviour); checked
+        // policies hand the overflow to Policy::overflow, which throws or returns a substitute.
+        template <typename Policy, typename T, typename W>
+        constexpr T policyNarrow(W value) {
+            T result = 0;
+            bool overflow = convertOverflow(value, result);
+            if constexpr (Policy::checked && FractionTraits<T>::is_bounded) {
+                if (overflow) {
+                    instrument(Counter::Overflows);
+                    return Policy::template overflow<T>(value < 0);
+                }
+            }
+            return result;
+        }
+        template <typename Policy, typename T>
+        constexpr T policyAdd(T a, T b) {
+            T result = 0;
+            bool overflow = addOverflow(a, b, result);
+            if constexpr (Policy::checked && FractionTraits<T>::is_bounded) {
+                if (overflow) {
+                    instrument(Counter::Overflows);
+                    return Policy::template overflow<T>(a < 0);
+                }
+            }
+            return result;
+        }
+        template <typename Policy, typename T>
+        constexpr T policySub(T a, T b) {
+            T result = 0;
+            bool overflow = subOverflow(a, b, result);
+            if constexpr (Policy::checked && FractionTraits<T>::is_bounded) {
+                if (overflow) {
+                    instrument(Counter::Overflows);
+                    return Policy::template overflow<T>(a < 0);
+                }
+            }
+            return result;
+        }
+        template <typename Policy, typename T>
+        constexpr T policyMul(T a, T b) {
+            T result = 0;
+            bool overflow = mulOverflow(a, b, result);
+            if constexpr (Policy::checked && FractionTraits<T>::is_bounded) {
+                if (overflow) {
+                    instrument(Counter::Overflows);
+                    return Policy::template overflow<T>((a < 0) != (b < 0));
+                }
+            }
+            return result;
+        }
+
+        /// @brief Divides both components by their GCD and moves the sign to the numerator.
+        template <typename W>
+        constexpr void reduceComponents(W& n, W& d) {
+            W g = 0;
+            if constexpr (FractionTraits<W>::is_bounded) {
+                g = static_cast<W>(gcdMagnitude(magnitude(n), magnitude(d)));
+            } else {
+                g = gcd(n, d);
+            }
+            if (g > 1) {
+                n /= g;
+                d /= g;
+            }
+            if (d < 0) {
+                n = -n;
+                d = -d;
+            }
+        }
+    }
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Overflow Policies
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Second template parameter of BasicFraction. A policy provides:
+    //  - `checked`: whether results are range-checked at all.
+    //  - `promoted_type<IntT>`: storage type of arithmetic results.
+    //  - `overflow<T>(negative)`: scalar result to use when a value does not fit in `T`.
+    //  - `narrowFraction<F>(n, d)`: fraction to use when a result's components do not fit in F.
+    //  - `normalized` (optional, default false): keep every value in canonical form, see Normalized.
+    //  - `lazy` and `threshold_bits` (optional): reduce only large results, see Lazy.
+    //  - `raises` (optional, default false): overflow is an error rather than a substitute, so
+    //    the try* functions report FractionError::Overflow instead of calling the policy. The
+    //    try* functions are noexcept, so a policy whose `overflow` throws must set it.
+    // Policies govern arithmetic results; parsing text or converting doubles that do not fit
+    // is rejected with std::overflow_error regardless of the policy.
+
+    /// @brief Throws std::overflow_error when a result does not fit (the default).
+    struct ThrowOnOverflow {
+        static constexpr bool checked = true;
+        static constexpr bool raises = true;
+        template <typename IntT> using promoted_type = IntT;
+
+        template <typename T>
+        [[noreturn]] static T overflow(bool) {
+            detail::throwError(std::overflow_error(detail::overflowErrorMessage));
+        }
+        template <typename F, typename W>
+        [[noreturn]] static F narrowFraction(W, W) {
+            detail::throwError(std::overflow_error(detail::overflowErrorMessage));
+        }
+    };
+
+    /// @brief Clamps results that do not fit. Scalars clamp to the type's min/max. A fraction
+    /// is reduced first; if it still does not fit it becomes the closest value that does:
+    /// +/-max when its magnitude is too large, otherwise both components are scaled down.
+    /// For the widest storage type intermediates clamp individually, so the result is bounded
+    /// but not necessarily the closest representable value.
+    struct SaturateOnOverflow {
+        static constexpr bool checked = true;
+        static constexpr bool raises = false;
+        template <typename IntT> using promoted_type = IntT;
+
+        template <typename T>
+        static constexpr T overflow(bool negative) noexcept {
+            return negative ? FractionTraits<T>::min() : FractionTraits<T>::max();
+        }
+        template <typename F, typename W>
+        static constexpr F narrowFraction(W n, W d) {
+            static_assert(FractionTraits<W>::is_bounded, "SaturateOnOverflow cannot narrow arbitrary-precision fractions.");
+            using T = typename F::value_type;
+            using U = detail::UnsignedOfT<W>;
+            bool negative = (n < 0) != (d < 0);
+            U un = detail::magnitude(n);
+            U ud = detail::magnitude(d);
+            U g = detail::gcdMagnitude(un, ud);
+            un /= g;
+            ud /= g;
+
+            const U limit = static_cast<U>(FractionTraits<T>::max());
+            if (un > limit || ud > limit) {
+                if (un / ud >= limit) {
+                    return F(negative ? FractionTraits<T>::min() : FractionTraits<T>::max(), 1);
+                }
+                // Scale both down to the widest values that fit, rounding to nearest
+                int shift = detail::bitWidth(un > ud ? un : ud) - detail::bitWidth(limit);
+                U half = static_cast<U>(U(1) << (shift - 1));
+                un = static_cast<U>((un >> shift) + ((un & half) != 0));
+                ud = static_cast<U>((ud >> shift) + ((ud & half) != 0));
+                if (un > limit) un = limit;
+                if (ud > limit) ud = limit;
+                if (ud == 0) ud = 1;
+                U h = detail::gcdMagnitude(un, ud);
+                un /= h;
+                ud /= h;
+            }
+            T tn = static_cast<T>(un);
+            return F(negative ? static_cast<T>(-tn) : tn, static_cast<T>(ud));
+        }
+    };
+
+    /// @brief No range checks at all: results wrap in two's complement. For hot loops whose
+    /// inputs are already known to stay in range.
+    struct UncheckedOverflow {
+        static constexpr bool checked = false;
+        static constexpr bool raises = false;
+        template <typename IntT> using promoted_type = IntT;
+
+        template <typename T>
+        static constexpr T overflow(bool) noexcept { return T(0); }
+        template <typename F, typename W>
+        static constexpr F narrowFraction(W n, W d) {
+            using T = typename F::value_type;
+            return F(static_cast<T>(n), static_cast<T>(d));
+        }
+    };
+
+    /// @brief Arithmetic results use the next wider storage type (`Fraction32 + Fraction32`
+    /// yields a 64-bit fraction), so they are exact. Narrowing back, e.g. in `+=`, reduces the
+    /// result first and throws std::overflow_error only if it still does not fit. The widest
+    /// type cannot be promoted and throws like ThrowOnOverflow.
+    struct PromoteOnOverflow {
+        static constexpr bool checked = true;
+        static constexpr bool raises = true;
+        template <typename IntT> using promoted_type = typename FractionTraits<IntT>::wide_type;
+
+        template <typename T>
+        [[noreturn]] static T overflow(bool) {
+            detail::throwError(std::overflow_error(detail::overflowErrorMessage));
+        }
+        template <typename F, typename W>
+        static constexpr F narrowFraction(W n, W d) {
+            using T = typename F::value_type;
+            detail::reduceComponents(n, d);
+            return F(detail::policyNarrow<ThrowOnOverflow, T>(n), detail::policyNarrow<ThrowOnOverflow, T>(d));
+        }
+    };
+
+    //\\\\\\\\\\\\\\\\\\\\/
+    // Normalization
+    //\\\\\\\\\\\\\\\\\\\\/
+    /// @brief Wraps an overflow policy and keeps every fraction in canonical form: lowest terms
+    /// with a positive denominator (zero is 0/1). Constructors, parsing, conversions and
+    /// arithmetic all reduce their results, so equal values have identical components,
+    /// equality compares two words and magnitudes stay small over long computations. Results
+    /// are reduced in the wide type before narrowing, so a result that only fits once reduced
+    /// no longer overflows. Writing `numerator` or `denominator` directly bypasses the invariant.
+    /// @example BasicFraction<int, Normalized<>> f(2, 4); // 1/2
+    template <typename Policy = ThrowOnOverflow>
+    struct Normalized : Policy {
+        using base_policy = Policy;
+        static constexpr bool normalized = true;
+    };
+
+    namespace detail {
+        /// @brief Whether a policy asks for canonical form. Policies without a `normalized`
+        /// member do not.
+        template <typename Policy, typename = void>
+        struct PolicyNormalizes : std::false_type {};
+        template <typename Policy>
+        struct PolicyNormalizes<Policy, std::void_t<decltype(Policy::normalized)>> : std::bool_constant<Policy::normalized> {};
+    }
+
+    /// @brief Wraps an overflow policy and defers reduction. Arithmetic results are left as
+    /// computed until a component needs more than `ThresholdBits` bits; only then are they
+    /// reduced. Each fraction remembers whether it is known to be in lowest terms, so output,
+    /// hashing and `Simplify` reduce only values that are not. Long chains of operations pay
+    /// for a GCD every few steps instead of every step, and magnitudes stay far from overflow.
+    /// `ThresholdBits` 0 picks half the storage width for built-in types (so the next product
+    /// still fits) and 256 bits for BigFraction. The flag makes the fraction one field larger.
+    /// Writing `numerator` or `denominator` directly leaves the flag stale.
+    /// @example BasicFraction<std::int64_t, Lazy<>> f(2, 4); // stays 2/4, prints "1/2"
+    template <typename Policy = ThrowOnOverflow, int ThresholdBits = 0>
+    struct Lazy : Policy {
+        static_assert(!detail::PolicyNormalizes<Policy>::value, "A normalized fraction is never lazy.");
+        static_assert(ThresholdBits >= 0, "The threshold is a number of bits.");
+        using base_policy = Policy;
+        static constexpr bool lazy = true;
+        static constexpr int threshold_bits = ThresholdBits;
+    };
+
+    namespace detail {
+        /// @brief Whether a policy treats overflow as an error. Policies without a `raises`
+        /// member do not.
+        template <typename Policy, typename = void>
+        struct PolicyRaises : std::false_type {};
+        template <typename Policy>
+        struct PolicyRaises<Policy, std::void_t<decltype(Policy::raises)>> : std::bool_constant<Policy::raises> {};
+
+        /// @brief Whether a policy defers reduction. Policies without a `lazy` member do not.
+        template <typename Policy, typename = void>
+        struct PolicyIsLazy : std::false_type {};
+        template <typename Policy>
+        struct PolicyIsLazy<Policy, std::void_t<decltype(Policy::lazy)>> : std::bool_constant<Policy::lazy> {};
+
+        /// @brief Component width above which a lazy `IntT` result is reduced.
+        template <typename Policy, typename IntT>
+        constexpr std::size_t lazyThresholdBits() noexcept {
+            if constexpr (Policy::threshold_bits > 0) {
+                return static_cast<std::size_t>(Policy::threshold_bits);
+            } else if constexpr (FractionTraits<IntT>::is_bounded) {
+                return sizeof(IntT) * 4;
+            } else {
+                return 256;
+            }
+        }
+
+        /// @brief Storage for a lazy fraction's "known to be in lowest terms" bit. Empty (and
+        /// so free, as a base class) for every other fraction.
+        template <bool Tracked>
+        struct ReducedFlag {
+            constexpr bool reducedFlag() const noexcept { return false; }
+            constexpr void setReducedFlag(bool) noexcept {}
+        };
+        template <>
+        struct ReducedFlag<true> {
+            bool reduced = false;
+            constexpr bool reducedFlag() const noexcept { return reduced; }
+            constexpr void setReducedFlag(bool value) noexcept { reduced = value; }
+        };
+    }
+}
@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  fraction_result.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include "fraction_parse.h"
+
+namespace FracLib {
+    /// @brief Why a `try*` operation failed. `None` on success.
+    enum class FractionError : std::uint8_t {
+        None,
+        /// A zero denominator or divisor.
+        ZeroDivisor,
+        /// The result does not fit and the overflow policy raises (ThrowOnOverflow and
+        /// PromoteOnOverflow). Saturating and unchecked policies substitute a value instead.
+        Overflow,
+        /// Text that is not a fraction, see `BasicFraction::parse`.
+        InvalidFormat
+    };
+
+    /// @brief The FractionError of a failed parse.
+    constexpr FractionError toFractionError(ParseError error) noexcept {
+        switch (error) {
+            case ParseError::None: return FractionError::None;
+            case ParseError::ZeroDenominator: return FractionError::ZeroDivisor;
+            case ParseError::Overflow: return FractionError::Overflow;
+            default: return FractionError::InvalidFormat;
+        }
+    }
+
+    /// @brief Value or error of a `try*` operation, in the spirit of `std::expected`. Holds a
+    /// default-constructed value on error. Nothing here throws: `value()` on an error is a
+    /// precondition violation rather than an exception, so check the result (or use
+    /// `valueOr`) first.
+    /// @example if (auto r = Fraction64::tryDivide(a, b)) sum += *r; else ++skipped;
+    template <typename T>
+    class FractionResult {
+    public:
+        using value_type = T;
+
+        constexpr FractionResult(const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value)
+            : result(value), status(FractionError::None) {}
+        constexpr FractionResult(FractionError error) noexcept(std::is_nothrow_default_constructible<T>::value)
+            : result(), status(error) {}
+
+        constexpr explicit operator bool() const noexcept { return status == FractionError::None; }
+        constexpr bool hasValue() const noexcept { return status == FractionError::None; }
+        constexpr FractionError error() const noexcept { return status; }
+
+        constexpr const T& value() const& noexcept { return result; }
+        constexpr T& value() & noexcept { return result; }
+        constexpr const T& operator*() const& noexcept { return result; }
+        constexpr T& operator*() & noexcept { return result; }
+        constexpr const T* operator->() const noexcept { return &result; }
+        constexpr T* operator->() noexcept { return &result; }
+        /// @brief The value, or `fallback` on error.
+        constexpr T valueOr(const T& fallback) const { return hasValue() ? result : fallback; }
+
+    private:
+        T result;
+        FractionError status;
+    };
+
+    namespace detail {
+        /// @brief `value` on success, otherwise `error`.
+        template <typename T>
+        constexpr FractionResult<T> makeResult(FractionError error, const T& value) noexcept(std::is_nothrow_copy_constructible<T>::value) {
+            if (error == FractionError::None) return FractionResult<T>(value);
+            return FractionResult<T>(error);
+        }
+    }
+}
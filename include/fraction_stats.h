@@ -0,0 +1,179 @@
+/**************************************************************************/
+/*  fraction_stats.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "fraction_traits.h"
+
+// Hot-path instrumentation (InstrumentationStats) is compiled out unless FRACLIB_INSTRUMENT is
+// nonzero. The library and everything linking it must agree: use the CMake option
+// FRACLIB_INSTRUMENT, which defines it for both.
+#ifndef FRACLIB_INSTRUMENT
+#define FRACLIB_INSTRUMENT 0
+#endif
+
+namespace FracLib {
+    /// @brief How `compare()` decided comparisons that reached its floating-point filter:
+    /// `BigFraction` operands of the same sign with different denominators, and widest-type
+    /// operands whose cross products overflow.
+    struct CompareStats {
+        /// @brief Comparisons decided by the double approximations alone.
+        std::uint64_t filtered = 0;
+        /// @brief Comparisons whose approximations were too close and fell back to exact arithmetic.
+        std::uint64_t exact = 0;
+
+        /// @brief Share of the comparisons reaching the filter that needed the exact fallback.
+        double fallbackRate() const noexcept {
+            std::uint64_t total = filtered + exact;
+            return total == 0 ? 0.0 : static_cast<double>(exact) / static_cast<double>(total);
+        }
+    };
+
+    /// @brief How often Normalized and Lazy fractions reduced their arithmetic results. Other
+    /// fractions are not counted.
+    struct ReductionStats {
+        /// @brief Results brought to lowest terms with a GCD.
+        std::uint64_t reduced = 0;
+        /// @brief Lazy results left as computed because they were below the threshold.
+        std::uint64_t deferred = 0;
+
+        /// @brief Share of the counted results that needed a GCD.
+        double reductionRate() const noexcept {
+            std::uint64_t total = reduced + deferred;
+            return total == 0 ? 0.0 : static_cast<double>(reduced) / static_cast<double>(total);
+        }
+    };
+
+    /// @brief What the arithmetic hot paths did, summed over every thread. Only counted when
+    /// built with FRACLIB_INSTRUMENT; otherwise the counting compiles away and all fields stay 0.
+    struct InstrumentationStats {
+        /// @brief `+` and `+=` with any operand type.
+        std::uint64_t additions = 0;
+        /// @brief `-` and `-=` with any operand type.
+        std::uint64_t subtractions = 0;
+        /// @brief `*` and `*=` with any operand type.
+        std::uint64_t multiplications = 0;
+        /// @brief `/` and `/=` with any operand type.
+        std::uint64_t divisions = 0;
+        /// @brief `compare` and the comparison operators.
+        std::uint64_t comparisons = 0;
+        /// @brief `simplify()` runs: direct calls, `Simplify`, simplifying constructors and parses,
+        /// and the ones Normalized fractions make on their own.
+        std::uint64_t simplifyCalls = 0;
+        /// @brief GCDs of built-in magnitudes, from simplification and result reduction.
+        std::uint64_t gcdCalls = 0;
+        /// @brief Binary GCD loop iterations. Table lookups take none.
+        std::uint64_t gcdIterations = 0;
+        /// @brief Results or intermediates that did not fit and went to the overflow policy.
+        std::uint64_t overflows = 0;
+        /// @brief `parse` calls, including the string constructors and the bulk loader.
+        std::uint64_t parseCalls = 0;
+        /// @brief Characters consumed by successful parses.
+        std::uint64_t parsedBytes = 0;
+        /// @brief Conversions from `double`.
+        std::uint64_t fromDouble = 0;
+        /// @brief `toDouble` and `toFloat` calls.
+        std::uint64_t toDouble = 0;
+    };
+
+    namespace detail {
+        /// @brief The calling thread's counters. Per thread, so counting never contends.
+        inline CompareStats& compareCounters() noexcept {
+            static thread_local CompareStats counters;
+            return counters;
+        }
+        inline ReductionStats& reductionCounters() noexcept {
+            static thread_local ReductionStats counters;
+            return counters;
+        }
+
+        /// @brief The InstrumentationStats fields, in order.
+        enum class Counter : unsigned {
+            Additions, Subtractions, Multiplications, Divisions, Comparisons, SimplifyCalls, GcdCalls,
+            GcdIterations, Overflows, ParseCalls, ParsedBytes, FromDouble, ToDouble, Count
+        };
+        inline constexpr std::size_t counterCount = static_cast<std::size_t>(Counter::Count);
+
+        /// @brief One thread's instrumentation counters. Only the owning thread writes them, with
+        /// a relaxed load and store rather than a locked increment; snapshots read them from any
+        /// thread. Trivial to construct and destroy, so the thread-local block needs no
+        /// initialization guard: the first count links it into the process-wide list, and a
+        /// separate thread-local object folds it into the list's total when the thread exits.
+        struct CounterBlock {
+            std::atomic<std::uint64_t> values[counterCount];
+            CounterBlock* previous;
+            CounterBlock* next;
+            bool registered;
+        };
+
+        inline thread_local CounterBlock threadCounters = {};
+
+        /// @brief Links the calling thread's block into the process-wide list.
+        void registerCounterBlock() noexcept;
+
+        /// @brief Adds `amount` to the calling thread's counter. Nothing without FRACLIB_INSTRUMENT.
+        constexpr void instrument(Counter counter, std::uint64_t amount = 1) noexcept {
+#if FRACLIB_INSTRUMENT
+            if (!isConstantEvaluated()) {
+                if (!threadCounters.registered) registerCounterBlock();
+                std::atomic<std::uint64_t>& value = threadCounters.values[static_cast<std::size_t>(counter)];
+                value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+            }
+#else
+            (void)counter;
+            (void)amount;
+#endif
+        }
+    }
+
+    /// @brief The calling thread's compare() filter counts since it started or last reset.
+    inline CompareStats compareStats() noexcept { return detail::compareCounters(); }
+    /// @brief Zeroes the calling thread's compare() filter counts.
+    inline void resetCompareStats() noexcept { detail::compareCounters() = CompareStats(); }
+    /// @brief The calling thread's reduction counts since it started or last reset.
+    inline ReductionStats reductionStats() noexcept { return detail::reductionCounters(); }
+    /// @brief Zeroes the calling thread's reduction counts.
+    inline void resetReductionStats() noexcept { detail::reductionCounters() = ReductionStats(); }
+
+    /// @brief Whether the library was built with the hot-path counters (FRACLIB_INSTRUMENT).
+    inline constexpr bool instrumentationEnabled = FRACLIB_INSTRUMENT != 0;
+    /// @brief Counts of every thread, running or exited, since the process started or the last
+    /// reset. Threads still counting may be mid-update, so a snapshot taken under load is only
+    /// consistent per field.
+    InstrumentationStats instrumentationStats() noexcept;
+    /// @brief Starts every thread's counts again from zero.
+    void resetInstrumentationStats() noexcept;
+}
+
+#ifdef FRACLIB_HEADER_ONLY
+#include "fraction_stats_impl.h"
+#endif
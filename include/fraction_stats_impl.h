@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*  fraction_stats_impl.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <mutex>
+#include "fraction_stats.h"
+
+namespace FracLib {
+    namespace detail {
+        /// @brief The running threads' counter blocks, and what exited threads counted.
+        struct CounterRegistry {
+            std::mutex mutex;
+            CounterBlock* head = nullptr;
+            std::uint64_t retired[counterCount] = {};
+            /// @brief Totals at the last reset. Subtracted instead of zeroing the blocks,
+            /// which only their own threads may write.
+            std::uint64_t baseline[counterCount] = {};
+        };
+
+        FRACLIB_INLINE CounterRegistry& counterRegistry() noexcept {
+            static CounterRegistry registry;
+            return registry;
+        }
+
+        /// @brief Unlinks the thread's block when the thread exits, keeping what it counted.
+        struct CounterBlockRetirer {
+            ~CounterBlockRetirer() {
+                CounterBlock& block = threadCounters;
+                CounterRegistry& registry = counterRegistry();
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                for (std::size_t i = 0; i < counterCount; ++i) registry.retired[i] += block.values[i].load(std::memory_order_relaxed);
+                if (block.previous) block.previous->next = block.next;
+                else registry.head = block.next;
+                if (block.next) block.next->previous = block.previous;
+                // Still marked registered: counts made after this point are dropped
+            }
+        };
+
+        FRACLIB_INLINE void registerCounterBlock() noexcept {
+            CounterBlock& block = threadCounters;
+            CounterRegistry& registry = counterRegistry();
+            {
+                std::lock_guard<std::mutex> lock(registry.mutex);
+                block.previous = nullptr;
+                block.next = registry.head;
+                if (block.next) block.next->previous = &block;
+                registry.head = &block;
+                block.registered = true;
+            }
+            static thread_local CounterBlockRetirer retirer;
+            (void)retirer;
+        }
+
+        /// @brief Everything counted since the process started. The caller holds the mutex.
+        FRACLIB_INLINE void counterTotals(CounterRegistry& registry, std::uint64_t (&totals)[counterCount]) noexcept {
+            for (std::size_t i = 0; i < counterCount; ++i) totals[i] = registry.retired[i];
+            for (CounterBlock* block = registry.head; block; block = block->next) {
+                for (std::size_t i = 0; i < counterCount; ++i) totals[i] += block->values[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    FRACLIB_INLINE InstrumentationStats instrumentationStats() noexcept {
+        using detail::Counter;
+        detail::CounterRegistry& registry = detail::counterRegistry();
+        std::uint64_t totals[detail::counterCount];
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            detail::counterTotals(registry, totals);
+            for (std::size_t i = 0; i < detail::counterCount; ++i) totals[i] -= registry.baseline[i];
+        }
+        auto at = [&](Counter counter) { return totals[static_cast<std::size_t>(counter)]; };
+        InstrumentationStats stats;
+        stats.additions = at(Counter::Additions);
+        stats.subtractions = at(Counter::Subtractions);
+        stats.multiplications = at(Counter::Multiplications);
+        stats.divisions = at(Counter::Divisions);
+        stats.comparisons = at(Counter::Comparisons);
+        stats.simplifyCalls = at(Counter::SimplifyCalls);
+        stats.gcdCalls = at(Counter::GcdCalls);
+        stats.gcdIterations = at(Counter::GcdIterations);
+        stats.overflows = at(Counter::Overflows);
+        stats.parseCalls = at(Counter::ParseCalls);
+        stats.parsedBytes = at(Counter::ParsedBytes);
+        stats.fromDouble = at(Counter::FromDouble);
+        stats.toDouble = at(Counter::ToDouble);
+        return stats;
+    }
+
+    FRACLIB_INLINE void resetInstrumentationStats() noexcept {
+        detail::CounterRegistry& registry = detail::counterRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        detail::counterTotals(registry, registry.baseline);
+    }
+}
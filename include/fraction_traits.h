@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*  fraction_traits.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <type_traits>
+
+#if defined(__SIZEOF_INT128__)
+#define FRACLIB_HAS_INT128 1
+#endif
+
+#if (defined(__clang__) && __clang_major__ >= 9) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 9) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define FRACLIB_HAS_CONSTANT_EVALUATED 1
+#endif
+
+// Functions that must run at compile time, such as the fraction literals. Before C++20 they
+// can only be constexpr.
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+#define FRACLIB_CONSTEVAL consteval
+#else
+#define FRACLIB_CONSTEVAL constexpr
+#endif
+
+// Builds without exceptions (-fno-exceptions) abort where the library would throw; the try*
+// functions of BasicFraction report those errors as values instead.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define FRACLIB_HAS_EXCEPTIONS 1
+#endif
+
+// Non-template definitions are compiled into the Fraction library. In header-only mode
+// (FRACLIB_HEADER_ONLY) their headers include them into every consumer, marked inline.
+#ifdef FRACLIB_HEADER_ONLY
+#define FRACLIB_INLINE inline
+#else
+#define FRACLIB_INLINE
+#endif
+
+namespace FracLib {
+#ifdef FRACLIB_HAS_INT128
+    __extension__ typedef __int128 int128_t;
+    __extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+    namespace detail {
+        /// @brief Maps a storage width (in bytes) to the next wider signed integer type.
+        /// The widest available type maps to itself.
+        template <std::size_t Bytes> struct WiderInt;
+        template <> struct WiderInt<1> { using type = std::int16_t; };
+        template <> struct WiderInt<2> { using type = std::int32_t; };
+        template <> struct WiderInt<4> { using type = std::int64_t; };
+#ifdef FRACLIB_HAS_INT128
+        template <> struct WiderInt<8> { using type = int128_t; };
+        template <> struct WiderInt<16> { using type = int128_t; };
+#else
+        template <> struct WiderInt<8> { using type = std::int64_t; };
+#endif
+
+        /// @brief True for the built-in integer types (including `__int128`, which strict
+        /// ISO modes do not report as integral). `bool` is excluded on purpose.
+        template <typename T> struct IsInteger
+            : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value> {};
+#ifdef FRACLIB_HAS_INT128
+        template <> struct IsInteger<int128_t> : std::true_type {};
+        template <> struct IsInteger<uint128_t> : std::true_type {};
+#endif
+
+        /// @brief True during constant evaluation, so constexpr code can skip runtime-only work
+        /// (such as statistics). Always false on compilers without the builtin.
+        constexpr bool isConstantEvaluated() noexcept {
+#ifdef FRACLIB_HAS_CONSTANT_EVALUATED
+            return __builtin_is_constant_evaluated();
+#else
+            return false;
+#endif
+        }
+
+        /// @brief Throws `error`, or aborts when exceptions are disabled.
+        template <typename E>
+        [[noreturn]] void throwError(const E& error) {
+#ifdef FRACLIB_HAS_EXCEPTIONS
+            throw error;
+#else
+            (void)error;
+            std::abort();
+#endif
+        }
+
+        template <typename T>
+        using EnableIfInteger = std::enable_if_t<IsInteger<std::remove_cv_t<T>>::value, int>;
+
+        /// @brief Largest value of a signed integer type, computed without relying on
+        /// `std::numeric_limits` (not specialized for `__int128` in strict ISO modes).
+        template <typename T>
+        constexpr T signedMax() noexcept {
+            return static_cast<T>(((static_cast<T>(1) << (sizeof(T) * 8 - 2)) - 1) * 2 + 1);
+        }
+
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Checked arithmetic
+        //\\\\\\\\\\\\\\\\\\\\/
+        // Each helper stores the (possibly wrapped) result in `result` and returns true when
+        // the mathematically exact value does not fit. Arbitrary-precision types (bigint.h)
+        // never overflow.
+        template <typename T>
+        constexpr bool addOverflow(T a, T b, T& result) noexcept(IsInteger<T>::value) {
+            if constexpr (IsInteger<T>::value) {
+                return __builtin_add_overflow(a, b, &result);
+            } else {
+                result = a + b;
+                return false;
+            }
+        }
+        template <typename T>
+        constexpr bool subOverflow(T a, T b, T& result) noexcept(IsInteger<T>::value) {
+            if constexpr (IsInteger<T>::value) {
+                return __builtin_sub_overflow(a, b, &result);
+            } else {
+                result = a - b;
+                return false;
+            }
+        }
+        template <typename T>
+        constexpr bool mulOverflow(T a, T b, T& result) noexcept(IsInteger<T>::value) {
+            if constexpr (IsInteger<T>::value) {
+                return __builtin_mul_overflow(a, b, &result);
+            } else {
+                result = a * b;
+                return false;
+            }
+        }
+        /// @brief Converts between integer types, reporting values that are not representable.
+        /// Arbitrary-precision sources report it through their `tryConvert(result)` member.
+        template <typename To, typename From>
+        constexpr bool convertOverflow(From value, To& result) noexcept(IsInteger<From>::value && IsInteger<To>::value) {
+            if constexpr (IsInteger<From>::value && IsInteger<To>::value) {
+                return __builtin_add_overflow(value, static_cast<From>(0), &result);
+            } else if constexpr (IsInteger<To>::value) {
+                return !value.tryConvert(result);
+            } else {
+                result = To(value);
+                return false;
+            }
+        }
+    }
+
+    /// @brief Describes the integer type a BasicFraction stores its components in and the
+    /// type its intermediate products are computed in.
+    /// @tparam IntT signed integer storage type (int16_t, int32_t, int64_t or int128_t).
+    template <typename IntT>
+    struct FractionTraits {
+        static_assert(detail::IsInteger<IntT>::value && static_cast<IntT>(-1) < static_cast<IntT>(0),
+            "FracLib fractions require a signed integer type.");
+
+        using value_type = IntT;
+        /// @brief Type intermediate products are computed in (twice the width when available).
+        using wide_type = typename detail::WiderInt<sizeof(IntT)>::type;
+
+        /// @brief True when `wide_type` can hold any product of two `value_type` values, so
+        /// intermediates only need to be range-checked once when narrowed back.
+        static constexpr bool has_wider = sizeof(wide_type) > sizeof(IntT);
+        /// @brief False for arbitrary-precision types, which have no min()/max() and never
+        /// overflow.
+        static constexpr bool is_bounded = true;
+
+        static constexpr IntT max() noexcept { return detail::signedMax<IntT>(); }
+        static constexpr IntT min() noexcept { return static_cast<IntT>(-max() - 1); }
+    };
+
+    namespace detail {
+        /// @brief True when every `From` value is representable as `To`. Selects the implicit
+        /// (widening) or explicit (narrowing) converting constructor of BasicFraction.
+        template <typename From, typename To>
+        struct IsWideningConversion : std::integral_constant<bool,
+            !FractionTraits<To>::is_bounded || (FractionTraits<From>::is_bounded && sizeof(From) <= sizeof(To))> {};
+    }
+}
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  mapped_file.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "fraction_traits.h"
+
+namespace FracLib {
+    /// @brief A read-only memory mapping of a whole file. The contents are paged in by the
+    /// OS on first access instead of being copied through stream buffers.
+    class MappedFile {
+    public: // CONSTRUCTORS
+        MappedFile() noexcept = default;
+        /// @brief Maps `path` read-only. An empty file maps to an empty view.
+        /// @throws std::system_error If the file cannot be opened or mapped.
+        explicit MappedFile(const std::string& path);
+        ~MappedFile() { close(); }
+        MappedFile(MappedFile&& other) noexcept { swap(other); }
+        MappedFile& operator=(MappedFile&& other) noexcept {
+            if (this != &other) {
+                close();
+                swap(other);
+            }
+            return *this;
+        }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+    public: // METHODS
+        const char* data() const noexcept { return data_; }
+        std::size_t size() const noexcept { return size_; }
+        std::string_view view() const noexcept { return std::string_view(data_, size_); }
+        /// @brief Unmaps the file. The view is empty afterwards.
+        void close() noexcept;
+
+    private:
+        void swap(MappedFile& other) noexcept;
+
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        void* file_ = nullptr;    // HANDLE
+        void* mapping_ = nullptr; // HANDLE
+#endif
+    };
+}
+
+#ifdef FRACLIB_HEADER_ONLY
+#include "mapped_file_impl.h"
+#endif
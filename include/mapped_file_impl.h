@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*  mapped_file_impl.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+// Out-of-line definitions for MappedFile. Compiled by src/mapped_file.cpp, or included by
+// mapped_file.h in header-only mode; do not include directly.
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace FracLib {
+#ifdef _WIN32
+    FRACLIB_INLINE MappedFile::MappedFile(const std::string& path) {
+        auto fail = [&](const char* what) {
+            std::error_code error(static_cast<int>(GetLastError()), std::system_category());
+            close();
+            detail::throwError(std::system_error(error, std::string(what) + " " + path));
+        };
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) fail("Cannot open");
+        file_ = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize)) fail("Cannot stat");
+        if (fileSize.QuadPart == 0) return;
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr) fail("Cannot map");
+        mapping_ = mapping;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) fail("Cannot map");
+        data_ = static_cast<const char*>(view);
+        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+    }
+
+    FRACLIB_INLINE void MappedFile::close() noexcept {
+        if (data_ != nullptr) UnmapViewOfFile(data_);
+        if (mapping_ != nullptr) CloseHandle(static_cast<HANDLE>(mapping_));
+        if (file_ != nullptr) CloseHandle(static_cast<HANDLE>(file_));
+        data_ = nullptr;
+        size_ = 0;
+        mapping_ = nullptr;
+        file_ = nullptr;
+    }
+
+    FRACLIB_INLINE void MappedFile::swap(MappedFile& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(file_, other.file_);
+        std::swap(mapping_, other.mapping_);
+    }
+#else
+    FRACLIB_INLINE MappedFile::MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            detail::throwError(std::system_error(errno, std::generic_category(), "Cannot open " + path));
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            int error = errno;
+            ::close(fd);
+            detail::throwError(std::system_error(error, std::generic_category(), "Cannot stat " + path));
+        }
+        if (info.st_size > 0) {
+            void* view = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view == MAP_FAILED) {
+                int error = errno;
+                ::close(fd);
+                detail::throwError(std::system_error(error, std::generic_category(), "Cannot map " + path));
+            }
+            // Readers scan their part of the file front to back
+            ::madvise(view, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(view);
+            size_ = static_cast<std::size_t>(info.st_size);
+        }
+        ::close(fd); // the mapping keeps the file alive
+    }
+
+    FRACLIB_INLINE void MappedFile::close() noexcept {
+        if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    FRACLIB_INLINE void MappedFile::swap(MappedFile& other) noexcept {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+#endif
+}
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  thread_pool.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             FracLib                                    */
+/*                        https://jodadev.com                             */
+/**************************************************************************/
+/* Copyright (c) 2024-present Edwin J Martinez (aka Ghost/JODA).          */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "fraction_traits.h"
+
+namespace FracLib {
+    /// @brief A fixed set of worker threads for the bulk operations (file loading, parallel
+    /// reductions). The calling thread always takes part in `parallelFor`, so a pool of size
+    /// 1 has no workers and runs everything inline.
+    class ThreadPool {
+    public: // CONSTRUCTORS
+        /// @brief Creates `threads - 1` workers. 0 uses std::thread::hardware_concurrency().
+        explicit ThreadPool(std::size_t threads = 0);
+        /// @brief Waits for queued tasks to finish, then joins the workers.
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+    public: // METHODS
+        /// @brief Number of threads `parallelFor` runs on, including the caller.
+        std::size_t size() const noexcept { return workers_.size() + 1; }
+
+        /// @brief Calls `body(i)` for every `i` in `[0, count)`, spread over the pool, and
+        /// returns once all calls have finished. Indices are handed out one at a time, so
+        /// uneven work balances itself. If a call throws, the remaining indices are skipped
+        /// and the first exception is rethrown here. Safe to call from inside a task.
+        template <typename Body>
+        void parallelFor(std::size_t count, Body&& body);
+
+        /// @brief Process-wide pool sized to the hardware, created on first use.
+        static ThreadPool& shared();
+
+    private:
+        /// @brief State of one parallelFor call. Shared with the helper tasks, which may start
+        /// after the call has returned and must then find no work left.
+        struct ForState {
+            std::atomic<std::size_t> next{0};
+            std::atomic<std::size_t> active{0};
+            std::size_t count = 0;
+            std::function<void(std::size_t)> body;
+            std::mutex mutex;
+            std::condition_variable done;
+            std::exception_ptr error;
+        };
+
+        void enqueue(std::function<void()> task);
+        void workerLoop();
+        /// @brief Claims and runs indices until none are left.
+        static void drain(ForState& state);
+
+        std::vector<std::thread> workers_;
+        std::deque<std::function<void()>> queue_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        bool stopping_ = false;
+    };
+
+    template <typename Body>
+    void ThreadPool::parallelFor(std::size_t count, Body&& body) {
+        if (count == 0) return;
+        if (workers_.empty() || count == 1) {
+            for (std::size_t i = 0; i < count; ++i) body(i);
+            return;
+        }
+
+        auto state = std::make_shared<ForState>();
+        state->count = count;
+        state->body = [&body](std::size_t i) { body(i); };
+
+        std::size_t helpers = std::min(workers_.size(), count - 1);
+        for (std::size_t h = 0; h < helpers; ++h) {
+            enqueue([state] { drain(*state); });
+        }
+        drain(*state);
+
+        // Every index is claimed; wait for the helpers still running one
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&] { return state->active.load() == 0; });
+        if (state->error) std::rethrow_exception(state->error);
+    }
+}
+
+#ifdef FRACLIB_HEADER_ONLY
+#include "thread_pool_impl.h"
+#endif